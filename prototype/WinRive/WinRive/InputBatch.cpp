@@ -0,0 +1,38 @@
+#include "pch.h"
+#include "InputBatch.h"
+#include "InputBatch.g.cpp"
+
+namespace winrt::WinRive::implementation
+{
+    void InputBatch::SetBoolean(uint64_t handle, bool value)
+    {
+        m_updates.push_back({ RiveRenderer::InputUpdate::Kind::Boolean, handle, value ? 1.0 : 0.0 });
+    }
+
+    void InputBatch::SetNumber(uint64_t handle, double value)
+    {
+        m_updates.push_back({ RiveRenderer::InputUpdate::Kind::Number, handle, value });
+    }
+
+    void InputBatch::FireTrigger(uint64_t handle)
+    {
+        m_updates.push_back({ RiveRenderer::InputUpdate::Kind::Trigger, handle, 0.0 });
+    }
+
+    uint32_t InputBatch::Count()
+    {
+        return static_cast<uint32_t>(m_updates.size());
+    }
+
+    void InputBatch::Clear()
+    {
+        m_updates.clear();
+    }
+
+    std::vector<RiveRenderer::InputUpdate> InputBatch::TakeUpdates()
+    {
+        std::vector<RiveRenderer::InputUpdate> updates;
+        updates.swap(m_updates);
+        return updates;
+    }
+}
@@ -0,0 +1,32 @@
+#pragma once
+#include "InputBatch.g.h"
+
+namespace winrt::WinRive::implementation
+{
+    struct InputBatch : InputBatchT<InputBatch>
+    {
+        InputBatch() = default;
+
+        // Collect input writes by handle (see RiveControl::GetInputHandle)
+        void SetBoolean(uint64_t handle, bool value);
+        void SetNumber(uint64_t handle, double value);
+        void FireTrigger(uint64_t handle);
+
+        uint32_t Count();
+        void Clear();
+
+        // Internal methods - hands the collected writes to the renderer and
+        // leaves the batch empty for reuse
+        std::vector<RiveRenderer::InputUpdate> TakeUpdates();
+
+    private:
+        std::vector<RiveRenderer::InputUpdate> m_updates;
+    };
+}
+
+namespace winrt::WinRive::factory_implementation
+{
+    struct InputBatch : InputBatchT<InputBatch, implementation::InputBatch>
+    {
+    };
+}
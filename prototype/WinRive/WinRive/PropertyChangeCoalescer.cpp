@@ -0,0 +1,144 @@
+#include "pch.h"
+#include "PropertyChangeCoalescer.h"
+
+#include <algorithm>
+#include <bit>
+
+namespace winrt::WinRive::implementation
+{
+    PropertyChangeCoalescer::PropertyChangeCoalescer(winrt::Windows::System::DispatcherQueue const& dispatcherQueue, DeliverHandler deliver)
+        : m_state(std::make_shared<State>()), m_dispatcherQueue(dispatcherQueue)
+    {
+        m_state->deliver = std::move(deliver);
+    }
+
+    PropertyChangeCoalescer::~PropertyChangeCoalescer()
+    {
+        if (m_timer)
+        {
+            m_timer.Stop();
+        }
+
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->deliver = nullptr;
+    }
+
+    void PropertyChangeCoalescer::SetInterval(std::chrono::milliseconds interval)
+    {
+        m_interval = interval.count() > 0 ? interval : std::chrono::milliseconds(0);
+
+        if (m_interval.count() > 0 && m_dispatcherQueue)
+        {
+            if (!m_timer)
+            {
+                m_timer = m_dispatcherQueue.CreateTimer();
+                m_timer.IsRepeating(false);
+                m_timer.Tick([weakState = std::weak_ptr<State>(m_state)](auto&&, auto&&)
+                {
+                    if (auto state = weakState.lock())
+                    {
+                        Deliver(state);
+                    }
+                });
+            }
+            m_timer.Interval(m_interval);
+        }
+    }
+
+    void PropertyChangeCoalescer::MarkDirty(int32_t slot)
+    {
+        if (slot < 0)
+        {
+            return;
+        }
+
+        bool schedule = false;
+        {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            size_t word = static_cast<size_t>(slot) / 64;
+            if (word >= m_state->dirty.size())
+            {
+                m_state->dirty.resize(word + 1, 0);
+            }
+            m_state->dirty[word] |= uint64_t(1) << (slot % 64);
+
+            if (!m_state->scheduled)
+            {
+                m_state->scheduled = true;
+                schedule = true;
+            }
+        }
+
+        if (!schedule)
+        {
+            return;
+        }
+
+        // The timer is started from the dispatcher thread that owns it
+        auto weakState = std::weak_ptr<State>(m_state);
+        auto timer = m_interval.count() > 0 ? m_timer : nullptr;
+        auto handler = [weakState, timer]()
+        {
+            if (timer)
+            {
+                timer.Start();
+            }
+            else if (auto state = weakState.lock())
+            {
+                Deliver(state);
+            }
+        };
+
+        // Never delivered from here - MarkDirty may be on any thread. With
+        // nowhere to queue the delivery the changes stay pending for Flush,
+        // and the next change tries to schedule again.
+        if (!m_dispatcherQueue || !m_dispatcherQueue.TryEnqueue(handler))
+        {
+            std::lock_guard<std::mutex> lock(m_state->mutex);
+            m_state->scheduled = false;
+        }
+    }
+
+    void PropertyChangeCoalescer::Flush()
+    {
+        if (m_timer)
+        {
+            m_timer.Stop();
+        }
+        Deliver(m_state);
+    }
+
+    void PropertyChangeCoalescer::Clear()
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        std::fill(m_state->dirty.begin(), m_state->dirty.end(), 0);
+    }
+
+    void PropertyChangeCoalescer::Deliver(std::shared_ptr<State> const& state)
+    {
+        std::vector<int32_t> slots;
+        DeliverHandler deliver;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->scheduled = false;
+
+            for (size_t word = 0; word < state->dirty.size(); ++word)
+            {
+                uint64_t bits = state->dirty[word];
+                while (bits)
+                {
+                    slots.push_back(static_cast<int32_t>(word * 64 + std::countr_zero(bits)));
+                    bits &= bits - 1;
+                }
+                state->dirty[word] = 0;
+            }
+            deliver = state->deliver;
+        }
+
+        // Outside the lock - handlers may write properties again
+        if (!slots.empty() && deliver)
+        {
+            deliver(slots);
+        }
+    }
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <winrt/Windows.System.h>
+
+namespace winrt::WinRive::implementation
+{
+    // Defers property change notifications and delivers them as one change
+    // set on the host dispatcher. A change marks its schema slot in a dirty
+    // bitset, so any number of writes to a property between deliveries are
+    // reported once and the handler reads the latest value. With no
+    // dispatcher changes are held until Flush.
+    class PropertyChangeCoalescer
+    {
+    public:
+        // Called on the dispatcher thread with the dirty slots in slot order
+        using DeliverHandler = std::function<void(std::vector<int32_t> const& slots)>;
+
+        PropertyChangeCoalescer(winrt::Windows::System::DispatcherQueue const& dispatcherQueue, DeliverHandler deliver);
+        ~PropertyChangeCoalescer();
+        PropertyChangeCoalescer(const PropertyChangeCoalescer&) = delete;
+        PropertyChangeCoalescer& operator=(const PropertyChangeCoalescer&) = delete;
+
+        // Zero delivers on the next dispatcher turn, which coalesces every
+        // write made during one UI frame. A positive interval delivers at
+        // most once per interval.
+        void SetInterval(std::chrono::milliseconds interval);
+        std::chrono::milliseconds GetInterval() const { return m_interval; }
+
+        // Any thread
+        void MarkDirty(int32_t slot);
+
+        // Deliver pending changes now, on the calling thread
+        void Flush();
+        // Drop pending changes, e.g. when the slots stop meaning the same properties
+        void Clear();
+
+    private:
+        struct State
+        {
+            std::mutex mutex;
+            std::vector<uint64_t> dirty;
+            bool scheduled = false;
+            DeliverHandler deliver;
+        };
+
+        static void Deliver(std::shared_ptr<State> const& state);
+
+        // Shared with queued callbacks so they outlive neither this nor its owner
+        std::shared_ptr<State> m_state;
+        winrt::Windows::System::DispatcherQueue m_dispatcherQueue{ nullptr };
+        winrt::Windows::System::DispatcherQueueTimer m_timer{ nullptr };
+        std::chrono::milliseconds m_interval{ 0 };
+    };
+}
@@ -2,12 +2,31 @@
 #include "RiveControl.h"
 #include "RiveControl.g.cpp"
 #include "ViewModelInstance.h"
+#include "InputBatch.h"
+
+namespace
+{
+    // UTF-8 copy of an input name in a per-thread buffer, so input updates at
+    // telemetry rates don't allocate a std::string per call
+    std::string_view InputNameToUtf8(winrt::hstring const& name)
+    {
+        thread_local std::string buffer;
+        int size = WideCharToMultiByte(CP_UTF8, 0, name.data(), static_cast<int>(name.size()), nullptr, 0, nullptr, nullptr);
+        buffer.resize(size > 0 ? size : 0);
+        if (size > 0)
+        {
+            WideCharToMultiByte(CP_UTF8, 0, name.data(), static_cast<int>(name.size()), buffer.data(), size, nullptr, nullptr);
+        }
+        return buffer;
+    }
+}
 
 namespace winrt::WinRive::implementation
 {
     RiveControl::RiveControl()
     {
         m_riveRenderer = std::make_unique<RiveRenderer>();
+        m_dispatcherQueue = winrt::Windows::System::DispatcherQueue::GetForCurrentThread();
     }
 
     RiveControl::~RiveControl()
@@ -21,6 +40,44 @@ namespace winrt::WinRive::implementation
         {
             m_width = width;
             m_height = height;
+
+            // Registered here rather than in the constructor, where get_weak isn't available yet
+            // Called on the render thread after a hot reload swap. The weak
+            // reference is only resolved on the UI thread, so the control is
+            // never released on the renderer's own thread; without a
+            // dispatcher there is no UI thread to tell and the event is dropped
+            m_riveRenderer->SetContentReloadedCallback([weakThis = get_weak(), dispatcherQueue = m_dispatcherQueue]()
+            {
+                if (dispatcherQueue)
+                {
+                    dispatcherQueue.TryEnqueue([weakThis]()
+                    {
+                        if (auto strongThis = weakThis.get())
+                        {
+                            strongThis->OnContentReloaded();
+                        }
+                    });
+                }
+            });
+
+            // Called on the render thread under the device lock, so it only
+            // queues the delivery; the weak reference is resolved on the UI
+            // thread. Without a dispatcher there is no UI thread to deliver on
+            // and nothing is registered.
+            if (m_dispatcherQueue)
+            {
+                m_riveRenderer->SetNotificationsAvailableCallback([weakThis = get_weak(), dispatcherQueue = m_dispatcherQueue]()
+                {
+                    return dispatcherQueue.TryEnqueue([weakThis]()
+                    {
+                        if (auto strongThis = weakThis.get())
+                        {
+                            strongThis->DeliverStateMachineNotifications();
+                        }
+                    });
+                });
+            }
+
             return m_riveRenderer->Initialize(compositor, width, height);
         }
         return false;
@@ -39,6 +96,8 @@ namespace winrt::WinRive::implementation
     {
         if (m_riveRenderer)
         {
+            // Native view models belong to the file being replaced
+            m_viewModelSchemas.clear();
             return m_riveRenderer->LoadRiveFile(winrt::to_string(filePath));
         }
         return false;
@@ -60,6 +119,16 @@ namespace winrt::WinRive::implementation
         }
     }
 
+    bool RiveControl::LoadRiveFileFromArchive(hstring const& archivePath, hstring const& entryName)
+    {
+        if (m_riveRenderer)
+        {
+            m_viewModelSchemas.clear();
+            return m_riveRenderer->LoadRiveFileFromArchive(winrt::to_string(archivePath), winrt::to_string(entryName));
+        }
+        return false;
+    }
+
     void RiveControl::StartRenderLoop()
     {
         if (m_riveRenderer)
@@ -92,6 +161,64 @@ namespace winrt::WinRive::implementation
         }
     }
 
+    void RiveControl::SetFixedTimestep(double stepSeconds, int32_t maxCatchUpSteps)
+    {
+        if (m_riveRenderer)
+        {
+            m_riveRenderer->SetFixedTimestep(static_cast<float>(stepSeconds), maxCatchUpSteps);
+        }
+    }
+
+    void RiveControl::SetTimeScale(double scale)
+    {
+        if (m_riveRenderer)
+        {
+            m_riveRenderer->SetTimeScale(static_cast<float>(scale));
+        }
+    }
+
+    double RiveControl::GetTimeScale()
+    {
+        if (m_riveRenderer)
+        {
+            return m_riveRenderer->GetTimeScale();
+        }
+        return 1.0;
+    }
+
+    bool RiveControl::SeekAnimation(double seconds)
+    {
+        if (m_riveRenderer)
+        {
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), seconds]()
+            {
+                renderer->SeekAnimation(static_cast<float>(seconds));
+            });
+            return true;
+        }
+        return false;
+    }
+
+    double RiveControl::GetAnimationTime()
+    {
+        float time = 0.0f;
+        if (m_riveRenderer)
+        {
+            m_riveRenderer->RunSynchronized([&]() { time = m_riveRenderer->GetAnimationTime(); });
+        }
+        return time;
+    }
+
+    double RiveControl::GetAnimationDuration()
+    {
+        float duration = 0.0f;
+        if (m_riveRenderer)
+        {
+            m_riveRenderer->RunSynchronized([&]() { duration = m_riveRenderer->GetAnimationDuration(); });
+        }
+        return duration;
+    }
+
     void RiveControl::SetSize(int32_t width, int32_t height)
     {
         m_width = width;
@@ -112,6 +239,200 @@ namespace winrt::WinRive::implementation
         }
     }
 
+    // Memory accounting
+    winrt::WinRive::RiveMemoryUsage RiveControl::GetMemoryUsage()
+    {
+        winrt::WinRive::RiveMemoryUsage result{};
+        
+        if (m_riveRenderer)
+        {
+            auto usage = m_riveRenderer->GetMemoryUsage();
+            result.SourceBytes = usage.sourceBytes;
+            result.SharedSourceBytes = usage.sharedSourceBytes;
+            result.FileBytes = usage.fileBytes;
+            result.ArtboardBytes = usage.artboardBytes;
+            result.StateMachineBytes = usage.stateMachineBytes;
+            result.ViewModelInstanceBytes = usage.viewModelInstanceBytes;
+            result.GpuBytes = usage.gpuBytes;
+            result.TotalBytes = usage.TotalBytes();
+        }
+        
+        return result;
+    }
+
+    void RiveControl::SetSourceDataPolicy(winrt::WinRive::RiveSourceDataPolicy policy)
+    {
+        if (m_riveRenderer)
+        {
+            m_riveRenderer->SetSourceDataPolicy(static_cast<RiveRenderer::SourceDataPolicy>(policy));
+        }
+    }
+
+    winrt::WinRive::RiveSourceDataPolicy RiveControl::GetSourceDataPolicy()
+    {
+        if (m_riveRenderer)
+        {
+            return static_cast<winrt::WinRive::RiveSourceDataPolicy>(m_riveRenderer->GetSourceDataPolicy());
+        }
+        return winrt::WinRive::RiveSourceDataPolicy::Retain;
+    }
+
+    // Development hot reload
+    void RiveControl::EnableHotReload(bool enable)
+    {
+        if (m_riveRenderer)
+        {
+            m_riveRenderer->EnableHotReload(enable);
+        }
+    }
+
+    bool RiveControl::IsHotReloadEnabled()
+    {
+        if (m_riveRenderer)
+        {
+            return m_riveRenderer->IsHotReloadEnabled();
+        }
+        return false;
+    }
+
+    void RiveControl::Prefetch(winrt::Windows::Foundation::Collections::IIterable<hstring> const& filePaths)
+    {
+        std::vector<std::string> paths;
+        for (auto const& path : filePaths)
+        {
+            paths.push_back(winrt::to_string(path));
+        }
+        RiveAssetCache::Instance().Prefetch(paths);
+    }
+
+    void RiveControl::CancelPrefetch()
+    {
+        RiveAssetCache::Instance().CancelPrefetch();
+    }
+
+    winrt::WinRive::RivePrefetchStatistics RiveControl::GetPrefetchStatistics()
+    {
+        auto statistics = RiveAssetCache::Instance().GetStatistics();
+
+        winrt::WinRive::RivePrefetchStatistics result{};
+        result.Requested = statistics.requested;
+        result.Completed = statistics.completed;
+        result.Failed = statistics.failed;
+        result.Cancelled = statistics.cancelled;
+        result.Hits = statistics.hits;
+        result.Misses = statistics.misses;
+        result.CachedBytes = statistics.cachedBytes;
+        result.CachedFiles = static_cast<uint32_t>(statistics.cachedFiles);
+        result.Pending = static_cast<uint32_t>(statistics.pending);
+        return result;
+    }
+
+    void RiveControl::OnContentReloaded()
+    {
+        // Runs on the UI thread, posted by the renderer's reload callback
+        if (!m_riveRenderer)
+        {
+            return;
+        }
+
+        m_viewModelSchemas.clear();
+
+        // The reload created a fresh native instance carrying the old values;
+        // rewrap it so the bound wrapper doesn't keep pointing at the old file
+        if (m_boundViewModelInstance)
+        {
+            // Pending slots belong to the old wrapper
+            if (m_viewModelChangeCoalescer)
+            {
+                m_viewModelChangeCoalescer->Clear();
+            }
+
+            void* nativeInstance = m_riveRenderer->GetBoundViewModelInstance();
+            auto defaultVM = GetDefaultViewModel();
+            if (nativeInstance && defaultVM)
+            {
+                auto instanceImpl = winrt::make<implementation::ViewModelInstance>(defaultVM);
+                instanceImpl.as<implementation::ViewModelInstance>()->SetNativeInstance(nativeInstance);
+                instanceImpl.as<implementation::ViewModelInstance>()->SetCommandQueue(m_riveRenderer->GetCommandQueue());
+                // Held like any created instance, so binding another one
+                // later doesn't free it under this wrapper
+                instanceImpl.as<implementation::ViewModelInstance>()->RegisterWith(m_riveRenderer->GetViewModelInstanceRegistry());
+                SetBoundViewModelInstance(instanceImpl.as<winrt::WinRive::ViewModelInstance>());
+                m_viewModelInstanceBoundEvent(*this, m_boundViewModelInstance);
+            }
+            else
+            {
+                SetBoundViewModelInstance(nullptr);
+            }
+        }
+
+        m_riveFileReloadedEvent(*this, nullptr);
+    }
+
+    void RiveControl::DeliverStateMachineNotifications()
+    {
+        if (!m_riveRenderer)
+        {
+            return;
+        }
+
+        // Take even without subscribers so the renderer signals again next time
+        size_t count = m_riveRenderer->TakeNotifications(m_notificationBuffer);
+        if (count == 0 || !m_stateMachineNotifiedEvent)
+        {
+            return;
+        }
+
+        std::vector<winrt::WinRive::RiveStateMachineNotification> notifications;
+        notifications.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            const auto& notification = m_notificationBuffer[i];
+            winrt::WinRive::RiveStateMachineNotification item{};
+            item.Kind = notification.kind == RiveRenderer::StateMachineNotification::Kind::Event
+                ? winrt::WinRive::RiveStateMachineNotificationKind::Event
+                : winrt::WinRive::RiveStateMachineNotificationKind::StateChanged;
+            item.Frame = notification.frame;
+            item.Name = winrt::to_hstring(notification.name);
+            item.SecondsDelay = notification.secondsDelay;
+            notifications.push_back(item);
+        }
+
+        m_stateMachineNotifiedEvent(*this, winrt::single_threaded_vector(std::move(notifications)).GetView());
+    }
+
+    void RiveControl::DeliverViewModelValueChanges()
+    {
+        if (!m_riveRenderer)
+        {
+            return;
+        }
+
+        size_t count = m_riveRenderer->TakeViewModelChanges(m_viewModelChangeBuffer);
+        if (count == 0 || !m_boundViewModelInstance || !m_viewModelValuesChangedEvent)
+        {
+            return;
+        }
+
+        // Only the changed properties are looked up; values are read by the
+        // handlers that want them
+        auto instance = m_boundViewModelInstance.as<implementation::ViewModelInstance>();
+        std::vector<winrt::WinRive::ViewModelInstanceProperty> changed;
+        changed.reserve(count);
+        for (uint32_t index : m_viewModelChangeBuffer)
+        {
+            if (auto property = instance->PropertyAt(instance->SlotForValueIndex(index)))
+            {
+                changed.push_back(property);
+            }
+        }
+
+        if (!changed.empty())
+        {
+            m_viewModelValuesChangedEvent(*this, winrt::single_threaded_vector(std::move(changed)).GetView());
+        }
+    }
+
     // Direct input methods for host applications to call
     void RiveControl::QueuePointerMove(float x, float y)
     {
@@ -140,12 +461,19 @@ namespace winrt::WinRive::implementation
     // State machine enumeration
     winrt::Windows::Foundation::Collections::IVectorView<winrt::WinRive::StateMachineInfo> RiveControl::GetStateMachines()
     {
-        std::vector<winrt::WinRive::StateMachineInfo> result;
-        
-        if (m_riveRenderer)
+        if (!m_riveRenderer)
         {
-            auto stateMachines = m_riveRenderer->EnumerateStateMachines();
-            for (const auto& sm : stateMachines)
+            return winrt::single_threaded_vector<WinRive::StateMachineInfo>().GetView();
+        }
+
+        // The renderer's collection only changes when content loads, so the
+        // same view is returned until then
+        auto stateMachines = m_riveRenderer->EnumerateStateMachines();
+        if (!m_stateMachinesView || stateMachines != m_stateMachinesSource)
+        {
+            std::vector<winrt::WinRive::StateMachineInfo> result;
+            result.reserve(stateMachines->size());
+            for (const auto& sm : *stateMachines)
             {
                 WinRive::StateMachineInfo info;
                 info.Name = winrt::to_hstring(sm.name);
@@ -153,9 +481,11 @@ namespace winrt::WinRive::implementation
                 info.IsDefault = sm.isDefault;
                 result.push_back(info);
             }
+            m_stateMachinesView = winrt::single_threaded_vector<WinRive::StateMachineInfo>(std::move(result)).GetView();
+            m_stateMachinesSource = std::move(stateMachines);
         }
         
-        return winrt::single_threaded_vector<WinRive::StateMachineInfo>(std::move(result)).GetView();
+        return m_stateMachinesView;
     }
 
     winrt::WinRive::StateMachineInfo RiveControl::GetDefaultStateMachine()
@@ -190,7 +520,13 @@ namespace winrt::WinRive::implementation
     {
         if (m_riveRenderer)
         {
-            return m_riveRenderer->SetActiveStateMachine(index);
+            // Applied on the render thread; true means the switch was queued.
+            // Input setters skip name checks until it lands.
+            m_riveRenderer->PostActivation([renderer = m_riveRenderer.get(), index]()
+            {
+                renderer->SetActiveStateMachine(index);
+            });
+            return true;
         }
         return false;
     }
@@ -199,7 +535,11 @@ namespace winrt::WinRive::implementation
     {
         if (m_riveRenderer)
         {
-            return m_riveRenderer->SetActiveStateMachineByName(winrt::to_string(name));
+            m_riveRenderer->PostActivation([renderer = m_riveRenderer.get(), name = winrt::to_string(name)]()
+            {
+                renderer->SetActiveStateMachineByName(name);
+            });
+            return true;
         }
         return false;
     }
@@ -208,7 +548,9 @@ namespace winrt::WinRive::implementation
     {
         if (m_riveRenderer)
         {
-            return m_riveRenderer->GetActiveStateMachineIndex();
+            int32_t index = -1;
+            m_riveRenderer->RunSynchronized([&]() { index = m_riveRenderer->GetActiveStateMachineIndex(); });
+            return index;
         }
         return -1;
     }
@@ -218,7 +560,7 @@ namespace winrt::WinRive::implementation
     {
         if (m_riveRenderer)
         {
-            m_riveRenderer->PlayStateMachine();
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get()]() { renderer->PlayStateMachine(); });
         }
     }
 
@@ -226,7 +568,7 @@ namespace winrt::WinRive::implementation
     {
         if (m_riveRenderer)
         {
-            m_riveRenderer->PauseStateMachine();
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get()]() { renderer->PauseStateMachine(); });
         }
     }
 
@@ -234,7 +576,7 @@ namespace winrt::WinRive::implementation
     {
         if (m_riveRenderer)
         {
-            m_riveRenderer->ResetStateMachine();
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get()]() { renderer->ResetStateMachine(); });
         }
     }
 
@@ -242,7 +584,9 @@ namespace winrt::WinRive::implementation
     {
         if (m_riveRenderer)
         {
-            return m_riveRenderer->IsStateMachineActive();
+            bool active = false;
+            m_riveRenderer->RunSynchronized([&]() { active = m_riveRenderer->IsStateMachineActive(); });
+            return active;
         }
         return false;
     }
@@ -250,12 +594,20 @@ namespace winrt::WinRive::implementation
     // Input control
     winrt::Windows::Foundation::Collections::IVectorView<winrt::WinRive::StateMachineInput> RiveControl::GetStateMachineInputs()
     {
-        std::vector<winrt::WinRive::StateMachineInput> result;
-        
-        if (m_riveRenderer)
+        if (!m_riveRenderer)
+        {
+            return winrt::single_threaded_vector<winrt::WinRive::StateMachineInput>().GetView();
+        }
+
+        // A new collection means a different machine or a changed value;
+        // otherwise the previous view is still accurate
+        std::shared_ptr<const std::vector<RiveRenderer::StateMachineInputInfo>> inputs;
+        m_riveRenderer->RunSynchronized([&]() { inputs = m_riveRenderer->GetStateMachineInputs(); });
+        if (!m_stateMachineInputsView || inputs != m_stateMachineInputsSource)
         {
-            auto inputs = m_riveRenderer->GetStateMachineInputs();
-            for (const auto& input : inputs)
+            std::vector<winrt::WinRive::StateMachineInput> result;
+            result.reserve(inputs->size());
+            for (const auto& input : *inputs)
             {
                 winrt::WinRive::StateMachineInput inputInfo;
                 inputInfo.Name = winrt::to_hstring(input.name);
@@ -264,38 +616,168 @@ namespace winrt::WinRive::implementation
                 inputInfo.NumberValue = input.numberValue;
                 result.push_back(inputInfo);
             }
+            m_stateMachineInputsView = winrt::single_threaded_vector(std::move(result)).GetView();
+            m_stateMachineInputsSource = std::move(inputs);
         }
         
-        return winrt::single_threaded_vector(std::move(result)).GetView();
+        return m_stateMachineInputsView;
     }
 
     bool RiveControl::SetBooleanInput(hstring const& inputName, bool value)
     {
-        if (m_riveRenderer)
+        // Input writes are applied on the render thread before its next
+        // advance; true means the active state machine has the input and the
+        // write was queued
+        auto name = InputNameToUtf8(inputName);
+        if (!m_riveRenderer)
+        {
+            return false;
+        }
+
+        uint64_t handle = m_riveRenderer->FindPublishedInputHandle(name, RiveRenderer::InputUpdate::Kind::Boolean);
+        if (handle != RiveRenderer::kInvalidInputHandle)
         {
-            return m_riveRenderer->SetBooleanInput(winrt::to_string(inputName), value);
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), handle, value]()
+            {
+                renderer->SetBooleanInputByHandle(handle, value);
+            });
+            return true;
+        }
+
+        // Only while an activation is pending is there no handle yet; the
+        // name is kept and resolved against the machine it activates
+        if (m_riveRenderer->HasInput(name, RiveRenderer::InputUpdate::Kind::Boolean))
+        {
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), name = std::string(name), value]()
+            {
+                renderer->SetBooleanInput(name, value);
+            });
+            return true;
         }
         return false;
     }
 
     bool RiveControl::SetNumberInput(hstring const& inputName, double value)
     {
-        if (m_riveRenderer)
+        auto name = InputNameToUtf8(inputName);
+        if (!m_riveRenderer)
         {
-            return m_riveRenderer->SetNumberInput(winrt::to_string(inputName), value);
+            return false;
+        }
+
+        uint64_t handle = m_riveRenderer->FindPublishedInputHandle(name, RiveRenderer::InputUpdate::Kind::Number);
+        if (handle != RiveRenderer::kInvalidInputHandle)
+        {
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), handle, value]()
+            {
+                renderer->SetNumberInputByHandle(handle, value);
+            });
+            return true;
+        }
+
+        // Only while an activation is pending is there no handle yet; the
+        // name is kept and resolved against the machine it activates
+        if (m_riveRenderer->HasInput(name, RiveRenderer::InputUpdate::Kind::Number))
+        {
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), name = std::string(name), value]()
+            {
+                renderer->SetNumberInput(name, value);
+            });
+            return true;
         }
         return false;
     }
 
     bool RiveControl::FireTrigger(hstring const& inputName)
+    {
+        auto name = InputNameToUtf8(inputName);
+        if (!m_riveRenderer)
+        {
+            return false;
+        }
+
+        uint64_t handle = m_riveRenderer->FindPublishedInputHandle(name, RiveRenderer::InputUpdate::Kind::Trigger);
+        if (handle != RiveRenderer::kInvalidInputHandle)
+        {
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), handle]()
+            {
+                renderer->FireTriggerByHandle(handle);
+            });
+            return true;
+        }
+
+        // Only while an activation is pending is there no handle yet; the
+        // name is kept and resolved against the machine it activates
+        if (m_riveRenderer->HasInput(name, RiveRenderer::InputUpdate::Kind::Trigger))
+        {
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), name = std::string(name)]()
+            {
+                renderer->FireTrigger(name);
+            });
+            return true;
+        }
+        return false;
+    }
+
+    uint64_t RiveControl::GetInputHandle(hstring const& inputName)
+    {
+        if (m_riveRenderer)
+        {
+            uint64_t handle = RiveRenderer::kInvalidInputHandle;
+            auto name = InputNameToUtf8(inputName);
+            m_riveRenderer->RunSynchronized([&]() { handle = m_riveRenderer->GetInputHandle(name); });
+            return handle;
+        }
+        return RiveRenderer::kInvalidInputHandle;
+    }
+
+    bool RiveControl::SetBooleanInputByHandle(uint64_t handle, bool value)
+    {
+        if (m_riveRenderer)
+        {
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), handle, value]()
+            {
+                renderer->SetBooleanInputByHandle(handle, value);
+            });
+            return handle != RiveRenderer::kInvalidInputHandle;
+        }
+        return false;
+    }
+
+    bool RiveControl::SetNumberInputByHandle(uint64_t handle, double value)
+    {
+        if (m_riveRenderer)
+        {
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), handle, value]()
+            {
+                renderer->SetNumberInputByHandle(handle, value);
+            });
+            return handle != RiveRenderer::kInvalidInputHandle;
+        }
+        return false;
+    }
+
+    bool RiveControl::FireTriggerByHandle(uint64_t handle)
     {
         if (m_riveRenderer)
         {
-            return m_riveRenderer->FireTrigger(winrt::to_string(inputName));
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), handle]()
+            {
+                renderer->FireTriggerByHandle(handle);
+            });
+            return handle != RiveRenderer::kInvalidInputHandle;
         }
         return false;
     }
 
+    void RiveControl::CommitInputBatch(winrt::WinRive::InputBatch const& batch)
+    {
+        if (m_riveRenderer && batch)
+        {
+            m_riveRenderer->CommitInputBatch(batch.as<implementation::InputBatch>()->TakeUpdates());
+        }
+    }
+
     // ViewModel support - matching IDL
     Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelInfo> RiveControl::GetViewModels()
     {
@@ -303,7 +785,10 @@ namespace winrt::WinRive::implementation
         
         if (m_riveRenderer)
         {
-            auto viewModels = m_riveRenderer->EnumerateViewModels();
+            // The file is swapped on the render thread by loads and hot
+            // reloads, so it's only read under the device lock
+            std::vector<RiveRenderer::ViewModelInfo> viewModels;
+            m_riveRenderer->RunSynchronized([&]() { viewModels = m_riveRenderer->EnumerateViewModels(); });
             for (const auto& vm : viewModels)
             {
                 winrt::WinRive::ViewModelInfo info;
@@ -324,27 +809,13 @@ namespace winrt::WinRive::implementation
             return nullptr;
         }
         
-        auto viewModels = m_riveRenderer->EnumerateViewModels();
         std::string nameStr = winrt::to_string(name);
-        
-        for (const auto& vm : viewModels)
-        {
-            if (vm.name == nameStr)
-            {
-                // Create ViewModel wrapper
-                auto viewModelImpl = winrt::make<implementation::ViewModel>(
-                    winrt::to_hstring(vm.name),
-                    vm.index,
-                    vm.id
-                );
-                viewModelImpl.as<implementation::ViewModel>()->SetNativeViewModel(vm.nativeViewModel);
-				//get viewmodel by name for viewmodel info
-                //set as private on viewmodel impl for later use 
-                return viewModelImpl.as<winrt::WinRive::ViewModel>();
-            }
-        }
-        
-        return nullptr;
+        winrt::WinRive::ViewModel viewModel{ nullptr };
+        m_riveRenderer->RunSynchronized([&]()
+        {
+            viewModel = MakeMatchingViewModel([&](RiveRenderer::ViewModelInfo const& vm) { return vm.name == nameStr; });
+        });
+        return viewModel;
     }
 
     winrt::WinRive::ViewModel RiveControl::GetViewModelAt(int32_t index)
@@ -354,22 +825,47 @@ namespace winrt::WinRive::implementation
             return nullptr;
         }
         
-        auto viewModels = m_riveRenderer->EnumerateViewModels();
-        
-        for (const auto& vm : viewModels)
+        winrt::WinRive::ViewModel viewModel{ nullptr };
+        m_riveRenderer->RunSynchronized([&]()
         {
-            if (vm.index == index)
+            viewModel = MakeMatchingViewModel([&](RiveRenderer::ViewModelInfo const& vm) { return vm.index == index; });
+        });
+        return viewModel;
+    }
+
+    winrt::WinRive::ViewModel RiveControl::MakeViewModel(RiveRenderer::ViewModelInfo const& info)
+    {
+        auto viewModelImpl = winrt::make<implementation::ViewModel>(
+            winrt::to_hstring(info.name),
+            info.index,
+            info.id
+        );
+
+        if (info.nativeViewModel)
+        {
+            // Wrappers are made per call, but the schema is built once per
+            // native view model and shared between them
+            auto& schema = m_viewModelSchemas[info.nativeViewModel];
+            if (!schema)
             {
-                // Create ViewModel wrapper
-                auto viewModelImpl = winrt::make<implementation::ViewModel>(
-                    winrt::to_hstring(vm.name),
-                    vm.index,
-                    vm.id
-                );
-                return viewModelImpl.as<winrt::WinRive::ViewModel>();
+                schema = implementation::ViewModelSchema::Build(info.nativeViewModel);
+            }
+            viewModelImpl.as<implementation::ViewModel>()->SetNativeViewModel(info.nativeViewModel);
+            viewModelImpl.as<implementation::ViewModel>()->SetSchema(schema);
+        }
+
+        return viewModelImpl.as<winrt::WinRive::ViewModel>();
+    }
+
+    winrt::WinRive::ViewModel RiveControl::MakeMatchingViewModel(std::function<bool(RiveRenderer::ViewModelInfo const&)> const& match)
+    {
+        for (const auto& vm : m_riveRenderer->EnumerateViewModels())
+        {
+            if (match(vm))
+            {
+                return MakeViewModel(vm);
             }
         }
-        
         return nullptr;
     }
 
@@ -377,7 +873,9 @@ namespace winrt::WinRive::implementation
     {
         if (m_riveRenderer)
         {
-            return m_riveRenderer->GetViewModelCount();
+            int32_t count = 0;
+            m_riveRenderer->RunSynchronized([&]() { count = m_riveRenderer->GetViewModelCount(); });
+            return count;
         }
         return 0;
     }
@@ -389,19 +887,16 @@ namespace winrt::WinRive::implementation
             return nullptr;
         }
         
-        auto defaultVM = m_riveRenderer->GetDefaultViewModel();
-        if (defaultVM.index >= 0)
+        winrt::WinRive::ViewModel viewModel{ nullptr };
+        m_riveRenderer->RunSynchronized([&]()
         {
-            // Create ViewModel wrapper
-            auto viewModelImpl = winrt::make<implementation::ViewModel>(
-                winrt::to_hstring(defaultVM.name),
-                defaultVM.index,
-                defaultVM.id
-            );
-            return viewModelImpl.as<winrt::WinRive::ViewModel>();
-        }
-        
-        return nullptr;
+            auto defaultVM = m_riveRenderer->GetDefaultViewModel();
+            if (defaultVM.index >= 0)
+            {
+                viewModel = MakeViewModel(defaultVM);
+            }
+        });
+        return viewModel;
     }
 
     // ViewModelInstance management
@@ -412,24 +907,20 @@ namespace winrt::WinRive::implementation
             return nullptr;
         }
         
-        // Create instance using default ViewModel (first one or artboard's ViewModel)
-        void* nativeInstance = m_riveRenderer->CreateViewModelInstance();
-        if (nativeInstance)
+        // Create instance using default ViewModel (first one or artboard's
+        // ViewModel), under the same lock as the lookup so both see one file
+        void* nativeInstance = nullptr;
+        winrt::WinRive::ViewModel viewModel{ nullptr };
+        m_riveRenderer->RunSynchronized([&]()
         {
-            // Get the default ViewModel to associate with the instance
-            auto defaultVM = GetDefaultViewModel();
-            if (defaultVM)
+            nativeInstance = m_riveRenderer->CreateViewModelInstance();
+            auto defaultVM = m_riveRenderer->GetDefaultViewModel();
+            if (nativeInstance && defaultVM.index >= 0)
             {
-                auto instanceImpl = winrt::make<implementation::ViewModelInstance>(defaultVM);
-                
-                // Set the native instance pointer
-                instanceImpl.as<implementation::ViewModelInstance>()->SetNativeInstance(nativeInstance);
-                
-                return instanceImpl.as<winrt::WinRive::ViewModelInstance>();
+                viewModel = MakeViewModel(defaultVM);
             }
-        }
-        
-        return nullptr;
+        });
+        return WrapCreatedInstance(nativeInstance, viewModel);
     }
 
     winrt::WinRive::ViewModelInstance RiveControl::CreateViewModelInstanceById(int32_t viewModelId)
@@ -439,34 +930,19 @@ namespace winrt::WinRive::implementation
             return nullptr;
         }
         
-        void* nativeInstance = m_riveRenderer->CreateViewModelInstanceById(viewModelId);
-        if (nativeInstance)
+        void* nativeInstance = nullptr;
+        winrt::WinRive::ViewModel viewModel{ nullptr };
+        m_riveRenderer->RunSynchronized([&]()
         {
-            // Find the ViewModel with this ID
-            auto viewModels = m_riveRenderer->EnumerateViewModels();
-            for (const auto& vm : viewModels)
+            nativeInstance = m_riveRenderer->CreateViewModelInstanceById(viewModelId);
+            if (nativeInstance)
             {
-                if (vm.id == viewModelId)
-                {
-                    auto viewModelWrapper = winrt::make<implementation::ViewModel>(
-                        winrt::to_hstring(vm.name),
-                        vm.index,
-                        vm.id
-                    );
-                    
-                    auto instanceImpl = winrt::make<implementation::ViewModelInstance>(
-                        viewModelWrapper.as<winrt::WinRive::ViewModel>()
-                    );
-                    
-                    // Set the native instance pointer
-                    instanceImpl.as<implementation::ViewModelInstance>()->SetNativeInstance(nativeInstance);
-                    
-                    return instanceImpl.as<winrt::WinRive::ViewModelInstance>();
-                }
+                // Find the ViewModel with this ID
+                viewModel = MakeMatchingViewModel([&](RiveRenderer::ViewModelInfo const& vm) { return vm.id == viewModelId; });
             }
-        }
+        });
         
-        return nullptr;
+        return WrapCreatedInstance(nativeInstance, viewModel);
     }
 
     winrt::WinRive::ViewModelInstance RiveControl::CreateViewModelInstanceByName(hstring const& viewModelName)
@@ -477,38 +953,43 @@ namespace winrt::WinRive::implementation
         }
         
         std::string nameStr = winrt::to_string(viewModelName);
-        void* nativeInstance = m_riveRenderer->CreateViewModelInstanceByName(nameStr);
-        if (nativeInstance)
+        void* nativeInstance = nullptr;
+        winrt::WinRive::ViewModel viewModel{ nullptr };
+        m_riveRenderer->RunSynchronized([&]()
         {
-            // Find the ViewModel with this name
-            auto viewModels = m_riveRenderer->EnumerateViewModels();
-            for (const auto& vm : viewModels)
+            nativeInstance = m_riveRenderer->CreateViewModelInstanceByName(nameStr);
+            if (nativeInstance)
             {
-                if (vm.name == nameStr)
-                {
-                    auto viewModelWrapper = winrt::make<implementation::ViewModel>(
-                        winrt::to_hstring(vm.name),
-                        vm.index,
-                        vm.id
-                    );
-                    
-					viewModelWrapper.as<implementation::ViewModel>()->SetNativeViewModel(vm.nativeViewModel);
-
-                    //Instance
-                    
-                    auto instanceImpl = winrt::make<implementation::ViewModelInstance>(
-                        viewModelWrapper.as<winrt::WinRive::ViewModel>()
-                    );
-                    
-                    // Set the native instance pointer
-                    instanceImpl.as<implementation::ViewModelInstance>()->SetNativeInstance(nativeInstance);
-                    
-                    return instanceImpl.as<winrt::WinRive::ViewModelInstance>();
-                }
+                // Find the ViewModel with this name
+                viewModel = MakeMatchingViewModel([&](RiveRenderer::ViewModelInfo const& vm) { return vm.name == nameStr; });
             }
-        }
+        });
         
-        return nullptr;
+        return WrapCreatedInstance(nativeInstance, viewModel);
+    }
+
+    winrt::WinRive::ViewModelInstance RiveControl::WrapCreatedInstance(void* nativeInstance, winrt::WinRive::ViewModel const& viewModel)
+    {
+        if (!nativeInstance)
+        {
+            return nullptr;
+        }
+
+        // The renderer registered the instance with one reference for us; the
+        // wrapper takes it over and hands it back when it's released
+        auto registry = m_riveRenderer->GetViewModelInstanceRegistry();
+        uint32_t handle = registry->HandleOf(nativeInstance);
+        if (!viewModel)
+        {
+            registry->Release(handle);
+            return nullptr;
+        }
+
+        auto instanceImpl = winrt::make<implementation::ViewModelInstance>(viewModel);
+        instanceImpl.as<implementation::ViewModelInstance>()->SetNativeInstance(nativeInstance);
+        instanceImpl.as<implementation::ViewModelInstance>()->SetCommandQueue(m_riveRenderer->GetCommandQueue());
+        instanceImpl.as<implementation::ViewModelInstance>()->AdoptRegistryReference(std::move(registry), handle);
+        return instanceImpl.as<winrt::WinRive::ViewModelInstance>();
     }
 
     bool RiveControl::BindViewModelInstance(winrt::WinRive::ViewModelInstance const& instance)
@@ -524,10 +1005,16 @@ namespace winrt::WinRive::implementation
         
         if (nativeInstance)
         {
-            bool success = m_riveRenderer->BindViewModelInstance(nativeInstance);
+            // Binding is structural, so it runs now under the device lock
+            bool success = false;
+            m_riveRenderer->RunSynchronized([&]() { success = m_riveRenderer->BindViewModelInstance(nativeInstance); });
             if (success)
             {
-                m_boundViewModelInstance = instance;
+                if (m_viewModelChangeCoalescer && m_boundViewModelInstance != instance)
+                {
+                    m_viewModelChangeCoalescer->Clear();
+                }
+                SetBoundViewModelInstance(instance);
                 
                 // Fire the bound event
                 m_viewModelInstanceBoundEvent(*this, instance);
@@ -547,135 +1034,306 @@ namespace winrt::WinRive::implementation
     // Direct property access (convenience methods)
     bool RiveControl::SetViewModelStringProperty(hstring const& propertyName, hstring const& value)
     {
+        // A bound wrapper resolves the name once and writes directly
+        if (m_boundViewModelInstance)
+        {
+            return SetViewModelStringPropertyByHandle(GetViewModelPropertyHandle(propertyName), value);
+        }
+
         if (m_riveRenderer)
         {
             std::string propName = winrt::to_string(propertyName);
             std::string propValue = winrt::to_string(value);
-            bool success = m_riveRenderer->SetViewModelStringProperty(propName, propValue);
-            
-            if (success && m_boundViewModelInstance)
+            // Applied on the render thread; true means the write was queued
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), propName = std::move(propName), propValue = std::move(propValue)]()
             {
-                // Fire property changed event if we have a bound instance
-                auto property = m_boundViewModelInstance.GetProperty(propertyName);
-                if (property)
-                {
-                    m_viewModelPropertyChangedEvent(*this, property);
-                }
-            }
-            
-            return success;
+                renderer->SetViewModelStringProperty(propName, propValue);
+            });
+            return true;
         }
         return false;
     }
 
     bool RiveControl::SetViewModelNumberProperty(hstring const& propertyName, double value)
     {
+        // A bound wrapper resolves the name once and writes directly
+        if (m_boundViewModelInstance)
+        {
+            return SetViewModelNumberPropertyByHandle(GetViewModelPropertyHandle(propertyName), value);
+        }
+
         if (m_riveRenderer)
         {
             std::string propName = winrt::to_string(propertyName);
-            bool success = m_riveRenderer->SetViewModelNumberProperty(propName, value);
-            
-            if (success && m_boundViewModelInstance)
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), propName = std::move(propName), value]()
             {
-                // Fire property changed event if we have a bound instance
-                auto property = m_boundViewModelInstance.GetProperty(propertyName);
-                if (property)
-                {
-                    m_viewModelPropertyChangedEvent(*this, property);
-                }
-            }
-            
-            return success;
+                renderer->SetViewModelNumberProperty(propName, value);
+            });
+            return true;
         }
         return false;
     }
 
     bool RiveControl::SetViewModelBooleanProperty(hstring const& propertyName, bool value)
     {
+        // A bound wrapper resolves the name once and writes directly
+        if (m_boundViewModelInstance)
+        {
+            return SetViewModelBooleanPropertyByHandle(GetViewModelPropertyHandle(propertyName), value);
+        }
+
         if (m_riveRenderer)
         {
             std::string propName = winrt::to_string(propertyName);
-            bool success = m_riveRenderer->SetViewModelBooleanProperty(propName, value);
-            
-            if (success && m_boundViewModelInstance)
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), propName = std::move(propName), value]()
             {
-                // Fire property changed event if we have a bound instance
-                auto property = m_boundViewModelInstance.GetProperty(propertyName);
-                if (property)
-                {
-                    m_viewModelPropertyChangedEvent(*this, property);
-                }
-            }
-            
-            return success;
+                renderer->SetViewModelBooleanProperty(propName, value);
+            });
+            return true;
         }
         return false;
     }
 
     bool RiveControl::SetViewModelColorProperty(hstring const& propertyName, uint32_t color)
     {
+        // A bound wrapper resolves the name once and writes directly
+        if (m_boundViewModelInstance)
+        {
+            return SetViewModelColorPropertyByHandle(GetViewModelPropertyHandle(propertyName), color);
+        }
+
         if (m_riveRenderer)
         {
             std::string propName = winrt::to_string(propertyName);
-            bool success = m_riveRenderer->SetViewModelColorProperty(propName, color);
-            
-            if (success && m_boundViewModelInstance)
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), propName = std::move(propName), color]()
             {
-                // Fire property changed event if we have a bound instance
-                auto property = m_boundViewModelInstance.GetProperty(propertyName);
-                if (property)
-                {
-                    m_viewModelPropertyChangedEvent(*this, property);
-                }
-            }
-            
-            return success;
+                renderer->SetViewModelColorProperty(propName, color);
+            });
+            return true;
         }
         return false;
     }
 
     bool RiveControl::SetViewModelEnumProperty(hstring const& propertyName, int32_t value)
     {
+        // A bound wrapper resolves the name once and writes directly
+        if (m_boundViewModelInstance)
+        {
+            return SetViewModelEnumPropertyByHandle(GetViewModelPropertyHandle(propertyName), value);
+        }
+
         if (m_riveRenderer)
         {
             std::string propName = winrt::to_string(propertyName);
-            bool success = m_riveRenderer->SetViewModelEnumProperty(propName, value);
-            
-            if (success && m_boundViewModelInstance)
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), propName = std::move(propName), value]()
             {
-                // Fire property changed event if we have a bound instance
-                auto property = m_boundViewModelInstance.GetProperty(propertyName);
-                if (property)
-                {
-                    m_viewModelPropertyChangedEvent(*this, property);
-                }
-            }
-            
-            return success;
+                renderer->SetViewModelEnumProperty(propName, value);
+            });
+            return true;
         }
         return false;
     }
 
     bool RiveControl::FireViewModelTrigger(hstring const& triggerName)
     {
+        if (m_boundViewModelInstance)
+        {
+            return FireViewModelTriggerByHandle(GetViewModelPropertyHandle(triggerName));
+        }
+
         if (m_riveRenderer)
         {
             std::string triggerNameStr = winrt::to_string(triggerName);
-            bool success = m_riveRenderer->FireViewModelTrigger(triggerNameStr);
-            
-            if (success && m_boundViewModelInstance)
+            m_riveRenderer->PostCommand([renderer = m_riveRenderer.get(), triggerNameStr = std::move(triggerNameStr)]()
+            {
+                renderer->FireViewModelTrigger(triggerNameStr);
+            });
+            return true;
+        }
+        return false;
+    }
+
+    uint64_t RiveControl::GetViewModelPropertyHandle(hstring const& propertyName)
+    {
+        if (m_boundViewModelInstance)
+        {
+            return m_boundViewModelInstance.GetPropertyHandle(propertyName);
+        }
+        return 0;
+    }
+
+    uint64_t RiveControl::CompileViewModelPath(hstring const& path)
+    {
+        if (m_boundViewModelInstance)
+        {
+            return m_boundViewModelInstance.CompilePath(path);
+        }
+        return 0;
+    }
+
+    bool RiveControl::SetViewModelStringPropertyByHandle(uint64_t handle, hstring const& value)
+    {
+        if (m_boundViewModelInstance && m_boundViewModelInstance.SetStringPropertyByHandle(handle, value))
+        {
+            RaiseViewModelPropertyChanged(handle);
+            return true;
+        }
+        return false;
+    }
+
+    bool RiveControl::SetViewModelNumberPropertyByHandle(uint64_t handle, double value)
+    {
+        if (m_boundViewModelInstance && m_boundViewModelInstance.SetNumberPropertyByHandle(handle, value))
+        {
+            RaiseViewModelPropertyChanged(handle);
+            return true;
+        }
+        return false;
+    }
+
+    bool RiveControl::SetViewModelBooleanPropertyByHandle(uint64_t handle, bool value)
+    {
+        if (m_boundViewModelInstance && m_boundViewModelInstance.SetBooleanPropertyByHandle(handle, value))
+        {
+            RaiseViewModelPropertyChanged(handle);
+            return true;
+        }
+        return false;
+    }
+
+    bool RiveControl::SetViewModelColorPropertyByHandle(uint64_t handle, uint32_t color)
+    {
+        if (m_boundViewModelInstance && m_boundViewModelInstance.SetColorPropertyByHandle(handle, color))
+        {
+            RaiseViewModelPropertyChanged(handle);
+            return true;
+        }
+        return false;
+    }
+
+    bool RiveControl::SetViewModelEnumPropertyByHandle(uint64_t handle, int32_t value)
+    {
+        if (m_boundViewModelInstance && m_boundViewModelInstance.SetEnumPropertyByHandle(handle, value))
+        {
+            RaiseViewModelPropertyChanged(handle);
+            return true;
+        }
+        return false;
+    }
+
+    bool RiveControl::FireViewModelTriggerByHandle(uint64_t handle)
+    {
+        if (m_boundViewModelInstance && m_boundViewModelInstance.FireTriggerByHandle(handle))
+        {
+            RaiseViewModelPropertyChanged(handle);
+            return true;
+        }
+        return false;
+    }
+
+    void RiveControl::SetViewModelChangeCoalescing(int32_t intervalMilliseconds)
+    {
+        if (intervalMilliseconds < 0)
+        {
+            if (m_viewModelChangeCoalescer)
             {
-                // Fire property changed event if we have a bound instance
-                auto property = m_boundViewModelInstance.GetProperty(triggerName);
-                if (property)
+                m_viewModelChangeCoalescer->Flush();
+                m_viewModelChangeCoalescer.reset();
+            }
+            return;
+        }
+
+        if (!m_viewModelChangeCoalescer)
+        {
+            m_viewModelChangeCoalescer = std::make_unique<PropertyChangeCoalescer>(m_dispatcherQueue,
+                [weakThis = get_weak()](std::vector<int32_t> const& slots)
                 {
-                    m_viewModelPropertyChangedEvent(*this, property);
-                }
+                    if (auto strongThis = weakThis.get())
+                    {
+                        strongThis->DeliverViewModelPropertyChanges(slots);
+                    }
+                });
+        }
+        m_viewModelChangeCoalescer->SetInterval(std::chrono::milliseconds(intervalMilliseconds));
+    }
+
+    void RiveControl::SetBoundViewModelInstance(winrt::WinRive::ViewModelInstance const& instance)
+    {
+        if (m_boundViewModelInstance == instance)
+        {
+            return;
+        }
+
+        // Staged writes belong to the old wrapper's update
+        if (m_boundViewModelInstance)
+        {
+            m_boundViewModelInstance.as<implementation::ViewModelInstance>()->SetCommittedCallback(nullptr);
+        }
+        m_stagedViewModelHandles.clear();
+
+        m_boundViewModelInstance = instance;
+        if (m_boundViewModelInstance)
+        {
+            // Commit runs on this thread, so the callback does too
+            m_boundViewModelInstance.as<implementation::ViewModelInstance>()->SetCommittedCallback(
+                [weakThis = get_weak()]()
+                {
+                    if (auto strongThis = weakThis.get())
+                    {
+                        strongThis->RaiseCommittedViewModelChanges();
+                    }
+                });
+        }
+    }
+
+    void RiveControl::RaiseCommittedViewModelChanges()
+    {
+        for (uint64_t handle : std::exchange(m_stagedViewModelHandles, {}))
+        {
+            RaiseViewModelPropertyChanged(handle);
+        }
+    }
+
+    void RiveControl::RaiseViewModelPropertyChanged(uint64_t handle)
+    {
+        auto instance = m_boundViewModelInstance.as<implementation::ViewModelInstance>();
+        if (instance->IsUpdating())
+        {
+            // Staged with the write; reported once when the update commits
+            if (std::find(m_stagedViewModelHandles.begin(), m_stagedViewModelHandles.end(), handle) ==
+                m_stagedViewModelHandles.end())
+            {
+                m_stagedViewModelHandles.push_back(handle);
+            }
+            return;
+        }
+
+        if (m_viewModelChangeCoalescer)
+        {
+            // A write through a path marks the nested view model it goes through
+            m_viewModelChangeCoalescer->MarkDirty(instance->RootSlotForHandle(handle));
+        }
+        else
+        {
+            m_viewModelPropertyChangedEvent(*this, instance->PropertyForHandle(handle));
+        }
+    }
+
+    void RiveControl::DeliverViewModelPropertyChanges(std::vector<int32_t> const& slots)
+    {
+        if (!m_boundViewModelInstance)
+        {
+            return;
+        }
+
+        auto instance = m_boundViewModelInstance.as<implementation::ViewModelInstance>();
+        for (int32_t slot : slots)
+        {
+            if (auto property = instance->PropertyAt(slot))
+            {
+                m_viewModelPropertyChangedEvent(*this, property);
             }
-            
-            return success;
         }
-        return false;
     }
 
     // Events
@@ -698,4 +1356,61 @@ namespace winrt::WinRive::implementation
     {
         m_viewModelPropertyChangedEvent.remove(token);
     }
+
+    winrt::event_token RiveControl::RiveFileReloaded(Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, Windows::Foundation::IInspectable> const& handler)
+    {
+        return m_riveFileReloadedEvent.add(handler);
+    }
+
+    void RiveControl::RiveFileReloaded(winrt::event_token const& token) noexcept
+    {
+        m_riveFileReloadedEvent.remove(token);
+    }
+
+    winrt::event_token RiveControl::StateMachineNotified(Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, Windows::Foundation::Collections::IVectorView<winrt::WinRive::RiveStateMachineNotification>> const& handler)
+    {
+        return m_stateMachineNotifiedEvent.add(handler);
+    }
+
+    void RiveControl::StateMachineNotified(winrt::event_token const& token) noexcept
+    {
+        m_stateMachineNotifiedEvent.remove(token);
+    }
+
+    winrt::event_token RiveControl::ViewModelValuesChanged(Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelInstanceProperty>> const& handler)
+    {
+        // The renderer only diffs values once someone listens
+        if (m_riveRenderer && m_dispatcherQueue && !m_viewModelChangeFeedStarted)
+        {
+            m_viewModelChangeFeedStarted = true;
+            // Same rule as notifications: the render thread only queues the
+            // delivery, and nothing is registered without a dispatcher
+            m_riveRenderer->SetViewModelChangesAvailableCallback([weakThis = get_weak(), dispatcherQueue = m_dispatcherQueue]()
+            {
+                return dispatcherQueue.TryEnqueue([weakThis]()
+                {
+                    if (auto strongThis = weakThis.get())
+                    {
+                        strongThis->DeliverViewModelValueChanges();
+                    }
+                });
+            });
+        }
+        return m_viewModelValuesChangedEvent.add(handler);
+    }
+
+    void RiveControl::ViewModelValuesChanged(winrt::event_token const& token) noexcept
+    {
+        m_viewModelValuesChangedEvent.remove(token);
+
+        // Last listener gone: stop diffing every frame
+        if (!m_viewModelValuesChangedEvent && m_viewModelChangeFeedStarted)
+        {
+            m_viewModelChangeFeedStarted = false;
+            if (m_riveRenderer)
+            {
+                m_riveRenderer->SetViewModelChangesAvailableCallback(nullptr);
+            }
+        }
+    }
 }
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "RiveControl.g.h"
+#include "ViewModelSchema.h"
+#include "PropertyChangeCoalescer.h"
 
 namespace winrt::WinRive::implementation
 {
@@ -21,11 +23,20 @@ namespace winrt::WinRive::implementation
         // Load a Rive file from a package
         bool LoadRiveFileFromPackage(hstring const& relativePath);
         
+        // Load a Rive file stored as a named entry in a .rivpack archive
+        bool LoadRiveFileFromArchive(hstring const& archivePath, hstring const& entryName);
+        
         // Control the rendering
         void StartRenderLoop();
         void StopRenderLoop();
         void PauseRendering();
         void ResumeRendering();
+        void SetFixedTimestep(double stepSeconds, int32_t maxCatchUpSteps);
+        void SetTimeScale(double scale);
+        double GetTimeScale();
+        bool SeekAnimation(double seconds);
+        double GetAnimationTime();
+        double GetAnimationDuration();
         
         // Update the size of the renderer
         void SetSize(int32_t width, int32_t height);
@@ -33,6 +44,20 @@ namespace winrt::WinRive::implementation
         // Clean up resources
         void Shutdown();
 
+        // Memory accounting
+        winrt::WinRive::RiveMemoryUsage GetMemoryUsage();
+        void SetSourceDataPolicy(winrt::WinRive::RiveSourceDataPolicy policy);
+        winrt::WinRive::RiveSourceDataPolicy GetSourceDataPolicy();
+
+        // Development hot reload
+        void EnableHotReload(bool enable);
+        bool IsHotReloadEnabled();
+
+        // Prefetch into the shared source cache
+        void Prefetch(winrt::Windows::Foundation::Collections::IIterable<hstring> const& filePaths);
+        void CancelPrefetch();
+        winrt::WinRive::RivePrefetchStatistics GetPrefetchStatistics();
+
         // State machine enumeration
         winrt::Windows::Foundation::Collections::IVectorView<winrt::WinRive::StateMachineInfo> GetStateMachines();
         winrt::WinRive::StateMachineInfo GetDefaultStateMachine();
@@ -55,6 +80,13 @@ namespace winrt::WinRive::implementation
         bool SetNumberInput(hstring const& inputName, double value);
         bool FireTrigger(hstring const& inputName);
 
+        // Handle-based input control
+        uint64_t GetInputHandle(hstring const& inputName);
+        bool SetBooleanInputByHandle(uint64_t handle, bool value);
+        bool SetNumberInputByHandle(uint64_t handle, double value);
+        bool FireTriggerByHandle(uint64_t handle);
+        void CommitInputBatch(winrt::WinRive::InputBatch const& batch);
+
         // Direct input methods for host applications to call
         void QueuePointerMove(float x, float y);
         void QueuePointerPress(float x, float y);
@@ -81,14 +113,42 @@ namespace winrt::WinRive::implementation
         bool SetViewModelColorProperty(hstring const& propertyName, uint32_t color);
         bool SetViewModelEnumProperty(hstring const& propertyName, int32_t value);
         bool FireViewModelTrigger(hstring const& triggerName);
+        uint64_t GetViewModelPropertyHandle(hstring const& propertyName);
+        uint64_t CompileViewModelPath(hstring const& path);
+        bool SetViewModelStringPropertyByHandle(uint64_t handle, hstring const& value);
+        bool SetViewModelNumberPropertyByHandle(uint64_t handle, double value);
+        bool SetViewModelBooleanPropertyByHandle(uint64_t handle, bool value);
+        bool SetViewModelColorPropertyByHandle(uint64_t handle, uint32_t color);
+        bool SetViewModelEnumPropertyByHandle(uint64_t handle, int32_t value);
+        bool FireViewModelTriggerByHandle(uint64_t handle);
+        void SetViewModelChangeCoalescing(int32_t intervalMilliseconds);
 
         // Events
         winrt::event_token ViewModelInstanceBound(Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, winrt::WinRive::ViewModelInstance> const& handler);
         void ViewModelInstanceBound(winrt::event_token const& token) noexcept;
         winrt::event_token ViewModelPropertyChanged(Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, winrt::WinRive::ViewModelInstanceProperty> const& handler);
         void ViewModelPropertyChanged(winrt::event_token const& token) noexcept;
+        winrt::event_token RiveFileReloaded(Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, Windows::Foundation::IInspectable> const& handler);
+        void RiveFileReloaded(winrt::event_token const& token) noexcept;
+        winrt::event_token StateMachineNotified(Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, Windows::Foundation::Collections::IVectorView<winrt::WinRive::RiveStateMachineNotification>> const& handler);
+        void StateMachineNotified(winrt::event_token const& token) noexcept;
+        winrt::event_token ViewModelValuesChanged(Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelInstanceProperty>> const& handler);
+        void ViewModelValuesChanged(winrt::event_token const& token) noexcept;
 
     private:
+        void OnContentReloaded();
+        void DeliverStateMachineNotifications();
+        void DeliverViewModelValueChanges();
+        winrt::WinRive::ViewModel MakeViewModel(RiveRenderer::ViewModelInfo const& info);
+        // First view model of the loaded file that matches; call under RunSynchronized
+        winrt::WinRive::ViewModel MakeMatchingViewModel(std::function<bool(RiveRenderer::ViewModelInfo const&)> const& match);
+        winrt::WinRive::ViewModelInstance WrapCreatedInstance(void* nativeInstance, winrt::WinRive::ViewModel const& viewModel);
+        void SetBoundViewModelInstance(winrt::WinRive::ViewModelInstance const& instance);
+        void RaiseViewModelPropertyChanged(uint64_t handle);
+        void RaiseCommittedViewModelChanges();
+        void DeliverViewModelPropertyChanges(std::vector<int32_t> const& slots);
+
+
         // The Rive renderer instance
         std::unique_ptr<RiveRenderer> m_riveRenderer;
         
@@ -99,9 +159,37 @@ namespace winrt::WinRive::implementation
         // Bound ViewModel instance
         winrt::WinRive::ViewModelInstance m_boundViewModelInstance{ nullptr };
 
+        // One schema per native view model of the loaded file, shared by all
+        // wrappers made for it. Cleared whenever the file changes.
+        std::unordered_map<void*, std::shared_ptr<const implementation::ViewModelSchema>> m_viewModelSchemas;
+
+        // Views handed out until the renderer's metadata collection changes
+        std::shared_ptr<const std::vector<RiveRenderer::StateMachineInfo>> m_stateMachinesSource;
+        Windows::Foundation::Collections::IVectorView<winrt::WinRive::StateMachineInfo> m_stateMachinesView{ nullptr };
+        std::shared_ptr<const std::vector<RiveRenderer::StateMachineInputInfo>> m_stateMachineInputsSource;
+        Windows::Foundation::Collections::IVectorView<winrt::WinRive::StateMachineInput> m_stateMachineInputsView{ nullptr };
+
+        // Handed back to the renderer on every take so its slots are reused
+        std::vector<RiveRenderer::StateMachineNotification> m_notificationBuffer;
+        std::vector<uint32_t> m_viewModelChangeBuffer;
+        bool m_viewModelChangeFeedStarted{ false };
+
+        // Set while ViewModelPropertyChanged is deferred, keyed by slot of the bound instance
+        std::unique_ptr<PropertyChangeCoalescer> m_viewModelChangeCoalescer;
+        // Handles written through the control during the bound instance's
+        // BeginUpdate/Commit, first-write order; raised once on commit
+        std::vector<uint64_t> m_stagedViewModelHandles;
+
+        // Dispatcher of the thread that created the control - renderer callbacks
+        // arrive on background threads and are marshaled here
+        winrt::Windows::System::DispatcherQueue m_dispatcherQueue{ nullptr };
+
         // Events
         winrt::event<Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, winrt::WinRive::ViewModelInstance>> m_viewModelInstanceBoundEvent;
         winrt::event<Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, winrt::WinRive::ViewModelInstanceProperty>> m_viewModelPropertyChangedEvent;
+        winrt::event<Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, Windows::Foundation::IInspectable>> m_riveFileReloadedEvent;
+        winrt::event<Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, Windows::Foundation::Collections::IVectorView<winrt::WinRive::RiveStateMachineNotification>>> m_stateMachineNotifiedEvent;
+        winrt::event<Windows::Foundation::TypedEventHandler<winrt::WinRive::RiveControl, Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelInstanceProperty>>> m_viewModelValuesChangedEvent;
     };
 }
 
@@ -30,32 +30,23 @@ namespace winrt::WinRive::implementation
 
     Windows::Foundation::Collections::IVectorView<WinRive::ViewModelPropertyInfo> ViewModel::GetProperties()
     {
-        if (!m_propertiesCached)
-        {
-            CacheProperties();
-        }
-        return winrt::single_threaded_vector<WinRive::ViewModelPropertyInfo>(std::move(m_properties)).GetView();
+        return Schema()->Infos();
     }
 
     int32_t ViewModel::GetPropertyCount()
     {
-        if (!m_propertiesCached)
-        {
-            CacheProperties();
-        }
-        return static_cast<int32_t>(m_properties.size());
+        return Schema()->Count();
     }
 
     WinRive::ViewModelPropertyInfo ViewModel::GetPropertyAt(int32_t index)
     {
-        if (!m_propertiesCached)
-        {
-            CacheProperties();
-        }
-
-        if (index >= 0 && index < static_cast<int32_t>(m_properties.size()))
+        if (auto property = Schema()->At(index))
         {
-            return m_properties[index];
+            WinRive::ViewModelPropertyInfo info{};
+            info.Name = property->name;
+            info.Type = property->type;
+            info.Index = property->index;
+            return info;
         }
 
         // Return empty property info for invalid index
@@ -68,18 +59,13 @@ namespace winrt::WinRive::implementation
 
     WinRive::ViewModelPropertyInfo ViewModel::GetPropertyByName(hstring const& name)
     {
-        // TODO Hack commenting this out
-    /*    if (!m_propertiesCached)
-        {
-            CacheProperties();
-        }*/
-
-        for (const auto& prop : m_properties)
+        if (auto property = Schema()->Find(name))
         {
-            if (prop.Name == name)
-            {
-                return prop;
-            }
+            WinRive::ViewModelPropertyInfo info{};
+            info.Name = property->name;
+            info.Type = property->type;
+            info.Index = property->index;
+            return info;
         }
 
         // Return empty property info for not found
@@ -94,7 +80,7 @@ namespace winrt::WinRive::implementation
     {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
         m_nativeViewModel = nativeViewModel;
-        m_propertiesCached = false; // Force re-cache of properties
+        m_schema = nullptr; // Rebuilt for the new view model on next use
 #else
         // Unused when rive headers not available
         (void)nativeViewModel;
@@ -110,59 +96,21 @@ namespace winrt::WinRive::implementation
 #endif
     }
 
-    void ViewModel::CacheProperties() const
+    void ViewModel::SetSchema(std::shared_ptr<const ViewModelSchema> schema)
     {
-        m_properties.clear();
-
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        if (m_nativeViewModel)
-        {
-            auto* nativeVM = static_cast<rive::ViewModel*>(m_nativeViewModel);
-            auto properties = nativeVM->properties();
-
-            for (size_t i = 0; i < properties.size(); ++i) {
-                auto property = properties[i];
-                if (property) {
-
-
-                    WinRive::ViewModelPropertyInfo info{};
-                    info.Name = winrt::to_hstring(property->name());
-                    info.Index = static_cast<int>(i);
-                    auto stringProperty = static_cast<rive::ViewModelPropertyString*>(property);
-                    if (stringProperty) {
-                        info.Type = WinRive::ViewModelPropertyType::String;
-                    }
-                    //auto listProperty = static_cast<rive::ViewModelPropertyList*>(property);
-                    //if (listProperty) {
-                    //    info.Type = WinRive::ViewModelPropertyType::List;
-                    //}
-                    
-                    //TODO: make this work
-                   // MapNativePropertyType(info.Name);
-                    m_properties.push_back(info);
-                }
-            }
-        }
-#endif
-        m_propertiesCached = true;
+        m_schema = std::move(schema);
     }
 
-    WinRive::ViewModelPropertyType ViewModel::MapNativePropertyType(winrt::hstring typename) const
+    std::shared_ptr<const ViewModelSchema> ViewModel::Schema() const
     {
-        // Use runtime property type detection instead of compile-time constants
-        // This avoids compilation errors with unknown enum values
-
-		return WinRive::ViewModelPropertyType::String; // Temporary stub to avoid compile errors
-
-        //switch (typename)
-        //{
-        //case 0: return WinRive::ViewModelPropertyType::String;
-        //case 1: return WinRive::ViewModelPropertyType::Number;
-        //case 2: return WinRive::ViewModelPropertyType::Boolean;
-        //case 3: return WinRive::ViewModelPropertyType::Color;
-        //case 4: return WinRive::ViewModelPropertyType::Enum;
-        //case 5: return WinRive::ViewModelPropertyType::Trigger;
-        //default: return WinRive::ViewModelPropertyType::String;
-        //}
+        if (!m_schema)
+        {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+            m_schema = m_nativeViewModel ? ViewModelSchema::Build(m_nativeViewModel) : ViewModelSchema::Empty();
+#else
+            m_schema = ViewModelSchema::Empty();
+#endif
+        }
+        return m_schema;
     }
 }
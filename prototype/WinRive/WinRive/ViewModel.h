@@ -1,5 +1,6 @@
 #pragma once
 #include "ViewModel.g.h"
+#include "ViewModelSchema.h"
 
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
 #include "rive/file.hpp"
@@ -28,6 +29,9 @@ namespace winrt::WinRive::implementation
 
         // Internal methods
         void SetNativeViewModel(void* nativeViewModel);
+        // Share a schema built elsewhere for the same native view model
+        void SetSchema(std::shared_ptr<const ViewModelSchema> schema);
+        std::shared_ptr<const ViewModelSchema> Schema() const;
         bool IsValid() const;
 
     private:
@@ -39,12 +43,8 @@ namespace winrt::WinRive::implementation
         void* m_nativeViewModel{ nullptr }; // Weak reference - owned by File
 #endif
 
-        // Cache for properties
-        mutable std::vector<WinRive::ViewModelPropertyInfo> m_properties;
-        mutable bool m_propertiesCached{ false };
-
-        void CacheProperties() const;
-        WinRive::ViewModelPropertyType MapNativePropertyType(winrt::hstring nativeType) const;
+        // Built on first use unless one was shared in through SetSchema
+        mutable std::shared_ptr<const ViewModelSchema> m_schema;
     };
 }
 
@@ -2,6 +2,36 @@
 #include "ViewModelInstance.h"
 #include "ViewModelInstance.g.cpp"
 #include "ViewModelInstanceProperty.h"
+#include "ViewModelList.h"
+#include "../../shared/viewmodel_snapshot.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+    // "a/b/c" into its segments; empty when any segment is
+    std::vector<winrt::hstring> SplitPath(winrt::hstring const& path)
+    {
+        std::vector<winrt::hstring> segments;
+        std::wstring_view rest(path);
+        while (true)
+        {
+            size_t separator = rest.find(L'/');
+            std::wstring_view segment = rest.substr(0, separator);
+            if (segment.empty())
+            {
+                return {};
+            }
+            segments.emplace_back(segment);
+            if (separator == std::wstring_view::npos)
+            {
+                return segments;
+            }
+            rest.remove_prefix(separator + 1);
+        }
+    }
+}
 
 namespace winrt::WinRive::implementation
 {
@@ -10,6 +40,14 @@ namespace winrt::WinRive::implementation
     {
     }
 
+    ViewModelInstance::~ViewModelInstance()
+    {
+        if (m_registry)
+        {
+            m_registry->Release(m_registryHandle);
+        }
+    }
+
     winrt::WinRive::ViewModel ViewModelInstance::ViewModel()
     {
         return m_viewModel;
@@ -21,7 +59,7 @@ namespace winrt::WinRive::implementation
         {
             CacheProperties();
         }
-        return winrt::single_threaded_vector<winrt::WinRive::ViewModelInstanceProperty>(std::move(m_properties)).GetView();
+        return m_propertiesView;
     }
 
     winrt::WinRive::ViewModelInstanceProperty ViewModelInstance::GetProperty(hstring const& name)
@@ -31,12 +69,10 @@ namespace winrt::WinRive::implementation
             CacheProperties();
         }
 
-        for (const auto& prop : m_properties)
+        int32_t slot = m_schema->IndexOf(name);
+        if (slot >= 0 && slot < static_cast<int32_t>(m_properties.size()))
         {
-            if (prop.Name() == name)
-            {
-                return prop;
-            }
+            return m_properties[slot];
         }
 
         return nullptr; // Not found
@@ -66,277 +102,1171 @@ namespace winrt::WinRive::implementation
         return static_cast<int32_t>(m_properties.size());
     }
 
-    bool ViewModelInstance::SetStringProperty(hstring const& name, hstring const& value)
+    winrt::WinRive::ViewModelList ViewModelInstance::GetList(hstring const& name)
     {
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+
+        int32_t slot = m_schema->IndexOf(name);
+        if (slot < 0)
+        {
+            return nullptr;
+        }
+
+        // One wrapper per list property, so its items and window persist
+        if (m_lists.size() != m_properties.size())
+        {
+            m_lists.resize(m_properties.size(), nullptr);
+        }
+        if (m_lists[slot])
+        {
+            return m_lists[slot];
+        }
+
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        if (!m_nativeInstance) {
+        auto* nativeList = static_cast<rive::ViewModelInstanceList*>(TypedValueForSlot(slot, winrt::WinRive::ViewModelPropertyType::List));
+        if (!nativeList)
+        {
+            return nullptr;
+        }
+
+        std::vector<rive::rcp<rive::ViewModelInstanceListItem>> existingItems;
+        RunOnRenderThread([&]()
+        {
+            for (const auto& item : nativeList->listItems())
+            {
+                existingItems.push_back(item);
+            }
+        });
+
+        auto list = winrt::make<implementation::ViewModelList>();
+        list.as<implementation::ViewModelList>()->Initialize(name, static_cast<rive::ViewModelInstance*>(m_nativeInstance),
+            nativeList, std::move(existingItems), m_commandQueue, m_registry);
+        m_lists[slot] = list.as<winrt::WinRive::ViewModelList>();
+        return m_lists[slot];
+#else
+        return nullptr;
+#endif
+    }
+
+    uint64_t ViewModelInstance::CompilePath(hstring const& path)
+    {
+        auto segments = SplitPath(path);
+        if (segments.size() == 1)
+        {
+            return GetPropertyHandle(segments[0]);
+        }
+        if (segments.empty())
+        {
+            return kInvalidPropertyHandle;
+        }
+
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+
+        uint32_t index;
+        auto found = m_compiledPathIndex.find(path);
+        if (found != m_compiledPathIndex.end())
+        {
+            index = found->second;
+        }
+        else
+        {
+            // Resolved now so a bad path fails here rather than on first write
+            CompiledPath compiled;
+            compiled.segments = std::move(segments);
+            if (m_compiledPaths.size() >= PropertyHandles::kMaxPaths || !ResolveCompiledPath(compiled))
+            {
+                return kInvalidPropertyHandle;
+            }
+            index = static_cast<uint32_t>(m_compiledPaths.size());
+            m_compiledPaths.push_back(std::move(compiled));
+            m_compiledPathIndex.emplace(path, index);
+        }
+        return m_handles.ForPath(index);
+    }
+
+    winrt::WinRive::ViewModelInstance ViewModelInstance::GetNestedInstance(hstring const& path)
+    {
+        auto segments = SplitPath(path);
+        return segments.empty() ? nullptr : WalkNested(segments, segments.size(), nullptr);
+    }
+
+    bool ViewModelInstance::SetNestedInstance(hstring const& path, winrt::WinRive::ViewModelInstance const& instance)
+    {
+        auto segments = SplitPath(path);
+        if (segments.empty() || !instance)
+        {
             return false;
         }
-        
-        auto* nativeInstance = static_cast<rive::ViewModelInstance*>(m_nativeInstance);
-        std::string propName = winrt::to_string(name);
-        std::string propValue = winrt::to_string(value);
-        
-        // Use the same pattern as RiveRenderer::SetViewModelStringProperty
-        auto property = nativeInstance->propertyValue(propName);
+
+        auto owner = WalkNested(segments, segments.size() - 1, nullptr);
+        return owner && winrt::get_self<ViewModelInstance>(owner)->ReplaceNested(segments.back(), instance);
+    }
+
+    bool ViewModelInstance::SetStringProperty(hstring const& name, hstring const& value)
+    {
+        return SetStringPropertyByHandle(GetPropertyHandle(name), value);
+    }
+
+    bool ViewModelInstance::SetNumberProperty(hstring const& name, double value)
+    {
+        return SetNumberPropertyByHandle(GetPropertyHandle(name), value);
+    }
+
+    bool ViewModelInstance::SetBooleanProperty(hstring const& name, bool value)
+    {
+        return SetBooleanPropertyByHandle(GetPropertyHandle(name), value);
+    }
+
+    bool ViewModelInstance::SetColorProperty(hstring const& name, uint32_t color)
+    {
+        return SetColorPropertyByHandle(GetPropertyHandle(name), color);
+    }
+
+    bool ViewModelInstance::SetEnumProperty(hstring const& name, int32_t value)
+    {
+        return SetEnumPropertyByHandle(GetPropertyHandle(name), value);
+    }
+
+    bool ViewModelInstance::FireTrigger(hstring const& name)
+    {
+        return FireTriggerByHandle(GetPropertyHandle(name));
+    }
+
+    uint64_t ViewModelInstance::GetPropertyHandle(hstring const& name)
+    {
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+
+        int32_t slot = m_schema->IndexOf(name);
+        if (slot < 0)
+        {
+            return kInvalidPropertyHandle;
+        }
+        return m_handles.ForSlot(slot);
+    }
+
+    bool ViewModelInstance::SetStringPropertyByHandle(uint64_t handle, hstring const& value)
+    {
+        auto* target = WriteTargetForHandle(handle);
+        if (target != this)
+        {
+            return target && target->SetStringPropertyByHandle(handle, value);
+        }
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        int32_t slot = SlotForHandle(handle);
+        auto* property = TypedValueForSlot(slot, winrt::WinRive::ViewModelPropertyType::String);
         if (property) {
-            auto stringProperty = static_cast<rive::ViewModelInstanceString*>(property);
-            if (stringProperty) {
-                stringProperty->propertyValue(propValue);
-                
-                // Fire property changed event
-                auto prop = GetProperty(name);
-                if (prop) {
-                    m_propertyChangedEvent(*this, prop);
-                }
-                return true;
-            }
+            SubmitWrite(slot, property, 0.0, winrt::to_string(value));
+            return true;
         }
 #else
         // Unused parameters
-        (void)name;
+        (void)handle;
         (void)value;
 #endif
         return false;
     }
 
-    bool ViewModelInstance::SetNumberProperty(hstring const& name, double value)
+    bool ViewModelInstance::SetNumberPropertyByHandle(uint64_t handle, double value)
     {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        if (!m_nativeInstance) {
-            return false;
+        auto* target = WriteTargetForHandle(handle);
+        if (target != this)
+        {
+            return target && target->SetNumberPropertyByHandle(handle, value);
         }
-        
-        auto* nativeInstance = static_cast<rive::ViewModelInstance*>(m_nativeInstance);
-        std::string propName = winrt::to_string(name);
-        
-        auto property = nativeInstance->propertyValue(propName);
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        int32_t slot = SlotForHandle(handle);
+        auto* property = TypedValueForSlot(slot, winrt::WinRive::ViewModelPropertyType::Number);
         if (property) {
-            auto numberProperty = static_cast<rive::ViewModelInstanceNumber*>(property);
-            if (numberProperty) {
-                numberProperty->propertyValue(static_cast<float>(value));
-                
-                // Fire property changed event
-                auto prop = GetProperty(name);
-                if (prop) {
-                    m_propertyChangedEvent(*this, prop);
-                }
-                return true;
-            }
+            SubmitWrite(slot, property, value, {});
+            return true;
         }
 #else
         // Unused parameters
-        (void)name;
+        (void)handle;
         (void)value;
 #endif
         return false;
     }
 
-    bool ViewModelInstance::SetBooleanProperty(hstring const& name, bool value)
+    bool ViewModelInstance::SetBooleanPropertyByHandle(uint64_t handle, bool value)
     {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        if (!m_nativeInstance) {
-            return false;
+        auto* target = WriteTargetForHandle(handle);
+        if (target != this)
+        {
+            return target && target->SetBooleanPropertyByHandle(handle, value);
         }
-        
-        auto* nativeInstance = static_cast<rive::ViewModelInstance*>(m_nativeInstance);
-        std::string propName = winrt::to_string(name);
-        
-        auto property = nativeInstance->propertyValue(propName);
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        int32_t slot = SlotForHandle(handle);
+        auto* property = TypedValueForSlot(slot, winrt::WinRive::ViewModelPropertyType::Boolean);
         if (property) {
-            auto boolProperty = static_cast<rive::ViewModelInstanceBoolean*>(property);
-            if (boolProperty) {
-                boolProperty->propertyValue(value);
-                
-                // Fire property changed event
-                auto prop = GetProperty(name);
-                if (prop) {
-                    m_propertyChangedEvent(*this, prop);
-                }
-                return true;
-            }
+            SubmitWrite(slot, property, value ? 1.0 : 0.0, {});
+            return true;
         }
 #else
         // Unused parameters
-        (void)name;
+        (void)handle;
         (void)value;
 #endif
         return false;
     }
 
-    bool ViewModelInstance::SetColorProperty(hstring const& name, uint32_t color)
+    bool ViewModelInstance::SetColorPropertyByHandle(uint64_t handle, uint32_t color)
     {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        if (!m_nativeInstance) {
-            return false;
+        auto* target = WriteTargetForHandle(handle);
+        if (target != this)
+        {
+            return target && target->SetColorPropertyByHandle(handle, color);
         }
-        
-        auto* nativeInstance = static_cast<rive::ViewModelInstance*>(m_nativeInstance);
-        std::string propName = winrt::to_string(name);
-        
-        auto property = nativeInstance->propertyValue(propName);
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        int32_t slot = SlotForHandle(handle);
+        auto* property = TypedValueForSlot(slot, winrt::WinRive::ViewModelPropertyType::Color);
         if (property) {
-            auto colorProperty = static_cast<rive::ViewModelInstanceColor*>(property);
-            if (colorProperty) {
-                colorProperty->propertyValue(color);
-                
-                // Fire property changed event
-                auto prop = GetProperty(name);
-                if (prop) {
-                    m_propertyChangedEvent(*this, prop);
-                }
-                return true;
-            }
+            SubmitWrite(slot, property, static_cast<double>(color), {});
+            return true;
         }
 #else
         // Unused parameters
-        (void)name;
+        (void)handle;
         (void)color;
 #endif
         return false;
     }
 
-    bool ViewModelInstance::SetEnumProperty(hstring const& name, int32_t value)
+    bool ViewModelInstance::SetEnumPropertyByHandle(uint64_t handle, int32_t value)
     {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        if (!m_nativeInstance) {
-            return false;
+        auto* target = WriteTargetForHandle(handle);
+        if (target != this)
+        {
+            return target && target->SetEnumPropertyByHandle(handle, value);
         }
-        
-        auto* nativeInstance = static_cast<rive::ViewModelInstance*>(m_nativeInstance);
-        std::string propName = winrt::to_string(name);
-        
-        auto property = nativeInstance->propertyValue(propName);
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        int32_t slot = SlotForHandle(handle);
+        auto* property = TypedValueForSlot(slot, winrt::WinRive::ViewModelPropertyType::Enum);
         if (property) {
-            auto enumProperty = static_cast<rive::ViewModelInstanceEnum*>(property);
-            if (enumProperty) {
-                enumProperty->propertyValue(static_cast<uint32_t>(value));
-                
-                // Fire property changed event
-                auto prop = GetProperty(name);
-                if (prop) {
-                    m_propertyChangedEvent(*this, prop);
-                }
-                return true;
-            }
+            SubmitWrite(slot, property, static_cast<double>(value), {});
+            return true;
         }
 #else
         // Unused parameters
-        (void)name;
+        (void)handle;
         (void)value;
 #endif
         return false;
     }
 
-    bool ViewModelInstance::FireTrigger(hstring const& name)
+    bool ViewModelInstance::FireTriggerByHandle(uint64_t handle)
     {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        if (!m_nativeInstance) {
-            return false;
+        auto* target = WriteTargetForHandle(handle);
+        if (target != this)
+        {
+            return target && target->FireTriggerByHandle(handle);
         }
-        
-        auto* nativeInstance = static_cast<rive::ViewModelInstance*>(m_nativeInstance);
-        std::string propName = winrt::to_string(name);
-        
-        auto property = nativeInstance->propertyValue(propName);
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        int32_t slot = SlotForHandle(handle);
+        auto* property = TypedValueForSlot(slot, winrt::WinRive::ViewModelPropertyType::Trigger);
         if (property) {
-            auto trigger = static_cast<rive::ViewModelInstanceTrigger*>(property);
-            if (trigger) {
-                trigger->trigger();
-                
-                // Fire property changed event
-                auto prop = GetProperty(name);
-                if (prop) {
-                    m_propertyChangedEvent(*this, prop);
-                }
-                return true;
-            }
+            SubmitWrite(slot, property, 0.0, {});
+            return true;
         }
 #else
         // Unused parameters
-        (void)name;
+        (void)handle;
 #endif
         return false;
     }
 
-    bool ViewModelInstance::IsValid() const
+    void ViewModelInstance::BeginUpdate()
     {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        return m_nativeInstance != nullptr;
-#else
-        return m_viewModel != nullptr;
-#endif
+        ++m_updateDepth;
     }
 
-    winrt::event_token ViewModelInstance::PropertyChanged(Windows::Foundation::TypedEventHandler<winrt::WinRive::ViewModelInstance, winrt::WinRive::ViewModelInstanceProperty> const& handler)
+    void ViewModelInstance::Commit()
     {
-        return m_propertyChangedEvent.add(handler);
-    }
+        if (m_updateDepth == 0 || --m_updateDepth > 0)
+        {
+            return;
+        }
 
-    void ViewModelInstance::PropertyChanged(winrt::event_token const& token) noexcept
-    {
-        m_propertyChangedEvent.remove(token);
-    }
+        std::vector<StagedUpdate> updates;
+        std::vector<winrt::com_ptr<ViewModelInstance>> committed;
+        CollectCommit(updates, committed);
 
-    void* ViewModelInstance::GetNativeInstance() const
-    {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        return m_nativeInstance;
-#else
-        return nullptr;
+        // One command for the whole update, nested instances written through
+        // paths included, so the render thread applies all of it between two
+        // frames or none of it
+        if (!updates.empty())
+        {
+            PostWrite([updates = std::move(updates)]()
+            {
+                for (const auto& update : updates)
+                {
+                    if (!update.links.Current())
+                    {
+                        continue;
+                    }
+                    for (const auto& write : update.writes)
+                    {
+                        WriteNativeValue(static_cast<rive::ViewModelInstanceValue*>(write.property), write.type, write.number,
+                            write.stringIndex < update.strings.size() ? update.strings[write.stringIndex] : std::string());
+                    }
+                }
+            });
+        }
 #endif
+
+        for (auto const& instance : committed)
+        {
+            instance->RaiseCommittedChanges();
+        }
+
+        if (auto callback = m_committedCallback)
+        {
+            callback();
+        }
     }
 
-    void ViewModelInstance::SetNativeInstance(void* nativeInstance)
+    void ViewModelInstance::SetCommittedCallback(std::function<void()> callback)
+    {
+        m_committedCallback = std::move(callback);
+    }
+
+    void ViewModelInstance::CollectCommit(std::vector<StagedUpdate>& updates,
+        std::vector<winrt::com_ptr<ViewModelInstance>>& committed)
     {
+        // Nested instances written through paths go first. One the host also
+        // opened an update on stays staged until the host commits it.
+        for (auto& nested : std::exchange(m_updatingNested, {}))
+        {
+            if (nested->m_updateDepth > 0 && --nested->m_updateDepth == 0)
+            {
+                nested->CollectCommit(updates, committed);
+            }
+        }
+
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        m_nativeInstance = nativeInstance;
-        InvalidatePropertyCache(); // Force re-cache of properties when native instance changes
-#else
-        // Unused when rive headers not available
-        (void)nativeInstance;
+        if (!m_stagedWrites.empty() && m_nativeInstance)
+        {
+            updates.push_back({ rive::ref_rcp(static_cast<rive::ViewModelInstance*>(m_nativeInstance)), m_nestedLinks,
+                std::move(m_stagedWrites), std::move(m_stagedStrings) });
+        }
 #endif
+        m_stagedWrites.clear();
+        m_stagedStrings.clear();
+        committed.push_back(get_strong());
     }
 
-    void ViewModelInstance::InvalidatePropertyCache()
+    void ViewModelInstance::RaiseCommittedChanges()
     {
-        m_propertiesCached = false;
-        m_properties.clear();
+        if (m_stagedSlots.empty())
+        {
+            return;
+        }
+
+        for (int32_t slot : m_stagedSlots)
+        {
+            if (slot < static_cast<int32_t>(m_slotStaged.size()))
+            {
+                m_slotStaged[slot] = false;
+            }
+        }
+
+        if (m_changeCoalescer)
+        {
+            for (int32_t slot : m_stagedSlots)
+            {
+                m_changeCoalescer->MarkDirty(slot);
+            }
+            m_stagedSlots.clear();
+            return;
+        }
+
+        // Reported like a coalesced delivery: PropertyChanged for each changed
+        // property, then PropertiesChanged with all of them
+        DeliverPropertyChanges(std::exchange(m_stagedSlots, {}));
     }
 
-    void ViewModelInstance::CacheProperties() const
+    void ViewModelInstance::SetChangeCoalescing(int32_t intervalMilliseconds)
     {
-        m_properties.clear();
-
-        if (!IsValid() || !m_viewModel)
+        if (intervalMilliseconds < 0)
         {
-            m_propertiesCached = true;
+            // Back to synchronous events; report what was still pending first
+            if (m_changeCoalescer)
+            {
+                m_changeCoalescer->Flush();
+                m_changeCoalescer.reset();
+            }
             return;
         }
 
-        
+        if (!m_changeCoalescer)
+        {
+            m_changeCoalescer = std::make_unique<PropertyChangeCoalescer>(
+                winrt::Windows::System::DispatcherQueue::GetForCurrentThread(),
+                [weakThis = get_weak()](std::vector<int32_t> const& slots)
+                {
+                    if (auto strongThis = weakThis.get())
+                    {
+                        strongThis->DeliverPropertyChanges(slots);
+                    }
+                });
+        }
+        m_changeCoalescer->SetInterval(std::chrono::milliseconds(intervalMilliseconds));
+    }
+
+    void ViewModelInstance::FlushPropertyChanges()
+    {
+        if (m_changeCoalescer)
+        {
+            m_changeCoalescer->Flush();
+        }
+    }
 
-        // Get properties from the view model definition
-        auto viewModelProperties = m_viewModel.GetProperties();
-        for (uint32_t i = 0; i < viewModelProperties.Size(); ++i)
+    void ViewModelInstance::DeliverPropertyChanges(std::vector<int32_t> const& slots)
+    {
+        std::vector<winrt::WinRive::ViewModelInstanceProperty> changed;
+        changed.reserve(slots.size());
+        for (int32_t slot : slots)
         {
-            auto propInfo = viewModelProperties.GetAt(i);
-            auto propertyWrapper = CreatePropertyWrapper(propInfo.Index, propInfo.Name);
-            if (propertyWrapper)
+            if (slot < static_cast<int32_t>(m_properties.size()))
             {
-                m_properties.push_back(propertyWrapper);
+                changed.push_back(m_properties[slot]);
             }
         }
+        if (changed.empty())
+        {
+            return;
+        }
+
+        // Per-property subscribers get one event per changed property, batch
+        // subscribers the whole set
+        for (auto const& property : changed)
+        {
+            m_propertyChangedEvent(*this, property);
+        }
+        m_propertiesChangedEvent(*this, winrt::single_threaded_vector(std::move(changed)).GetView());
+    }
+
+    winrt::event_token ViewModelInstance::PropertiesChanged(Windows::Foundation::TypedEventHandler<winrt::WinRive::ViewModelInstance, Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelInstanceProperty>> const& handler)
+    {
+        return m_propertiesChangedEvent.add(handler);
+    }
+
+    void ViewModelInstance::PropertiesChanged(winrt::event_token const& token) noexcept
+    {
+        m_propertiesChangedEvent.remove(token);
+    }
+
+    winrt::WinRive::ViewModelInstanceProperty ViewModelInstance::PropertyForHandle(uint64_t handle)
+    {
+        auto* target = ResolvePathHandle(handle);
+        if (target != this)
+        {
+            return target ? target->PropertyForHandle(handle) : nullptr;
+        }
+
+        int32_t slot = SlotForHandle(handle);
+        return slot >= 0 ? m_properties[slot] : nullptr;
+    }
+
+    winrt::WinRive::ViewModelInstanceProperty ViewModelInstance::PropertyAt(int32_t slot)
+    {
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+        return slot >= 0 && slot < static_cast<int32_t>(m_properties.size()) ? m_properties[slot] : nullptr;
+    }
+
+    int32_t ViewModelInstance::SlotForHandle(uint64_t handle)
+    {
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+
+        return m_handles.SlotOf(handle, m_properties.size());
+    }
+
+    int32_t ViewModelInstance::RootSlotForHandle(uint64_t handle)
+    {
+        if (!PropertyHandles::IsPath(handle))
+        {
+            return SlotForHandle(handle);
+        }
+
+        uint64_t leafHandle = handle;
+        if (!ResolvePathHandle(leafHandle))
+        {
+            return -1;
+        }
+        return m_compiledPaths[m_handles.PathOf(handle, m_compiledPaths.size())].rootSlot;
+    }
+
+    int32_t ViewModelInstance::SlotForValueIndex(uint32_t valueIndex)
+    {
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // The schema skips properties the view model leaves null, so native
+        // value indices and slots don't line up
+        if (!m_valueSlotsBuilt && m_nativeInstance)
+        {
+            const auto& values = static_cast<rive::ViewModelInstance*>(m_nativeInstance)->propertyValues();
+            m_valueSlots.reserve(values.size());
+            for (auto value : values)
+            {
+                m_valueSlots.push_back(value && value->viewModelProperty()
+                    ? m_schema->IndexOf(winrt::to_hstring(value->viewModelProperty()->name()))
+                    : -1);
+            }
+            m_valueSlotsBuilt = true;
+        }
+        return valueIndex < m_valueSlots.size() ? m_valueSlots[valueIndex] : -1;
+#else
+        (void)valueIndex; // Unused parameter when Rive headers not available
+        return -1;
+#endif
+    }
+
+    void ViewModelInstance::RaisePropertyChanged(int32_t slot)
+    {
+        if (slot < 0 || slot >= static_cast<int32_t>(m_properties.size()))
+        {
+            return;
+        }
+
+        if (m_changeCoalescer)
+        {
+            m_changeCoalescer->MarkDirty(slot);
+        }
+        else
+        {
+            m_propertyChangedEvent(*this, m_properties[slot]);
+        }
+    }
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    void ViewModelInstance::SubmitWrite(int32_t slot, rive::ViewModelInstanceValue* property, double number, std::string text)
+    {
+        const auto type = m_schema->At(slot)->type;
+        if (m_updateDepth > 0)
+        {
+            // Staged until Commit; the change is reported once then
+            uint32_t stringIndex = kNoStagedString;
+            if (type == winrt::WinRive::ViewModelPropertyType::String)
+            {
+                stringIndex = static_cast<uint32_t>(m_stagedStrings.size());
+                m_stagedStrings.push_back(std::move(text));
+            }
+            m_stagedWrites.push_back({ property, type, number, stringIndex });
+            if (!m_slotStaged[slot])
+            {
+                m_slotStaged[slot] = true;
+                m_stagedSlots.push_back(slot);
+            }
+            return;
+        }
+
+        PostWrite([keepAlive = rive::ref_rcp(static_cast<rive::ViewModelInstance*>(m_nativeInstance)), links = m_nestedLinks,
+            property, type, number, text = std::move(text)]()
+        {
+            if (links.Current())
+            {
+                WriteNativeValue(property, type, number, text);
+            }
+        });
+        RaisePropertyChanged(slot);
+    }
+
+    void ViewModelInstance::WriteNativeValue(rive::ViewModelInstanceValue* property, winrt::WinRive::ViewModelPropertyType type,
+        double number, std::string const& text)
+    {
+        // Type comes from the schema and was checked when the write was accepted
+        switch (type)
+        {
+        case winrt::WinRive::ViewModelPropertyType::String:
+            static_cast<rive::ViewModelInstanceString*>(property)->propertyValue(text);
+            break;
+        case winrt::WinRive::ViewModelPropertyType::Number:
+            static_cast<rive::ViewModelInstanceNumber*>(property)->propertyValue(static_cast<float>(number));
+            break;
+        case winrt::WinRive::ViewModelPropertyType::Boolean:
+            static_cast<rive::ViewModelInstanceBoolean*>(property)->propertyValue(number != 0.0);
+            break;
+        case winrt::WinRive::ViewModelPropertyType::Color:
+            static_cast<rive::ViewModelInstanceColor*>(property)->propertyValue(static_cast<int>(static_cast<uint32_t>(number)));
+            break;
+        case winrt::WinRive::ViewModelPropertyType::Enum:
+            static_cast<rive::ViewModelInstanceEnum*>(property)->propertyValue(static_cast<uint32_t>(number));
+            break;
+        case winrt::WinRive::ViewModelPropertyType::Trigger:
+            static_cast<rive::ViewModelInstanceTrigger*>(property)->trigger();
+            break;
+        default:
+            break;
+        }
+    }
+
+    rive::ViewModelInstanceValue* ViewModelInstance::ValueForSlot(int32_t slot)
+    {
+        if (slot < 0 || !m_nativeInstance)
+        {
+            return nullptr;
+        }
+
+        // Resolved once per native instance; the value objects live as long
+        // as the instance, which the posted writes keep alive
+        if (!m_slotResolved[slot])
+        {
+            auto* nativeInstance = static_cast<rive::ViewModelInstance*>(m_nativeInstance);
+            m_resolvedValues[slot] = nativeInstance->propertyValue(m_schema->At(slot)->nativeName);
+            m_slotResolved[slot] = true;
+        }
+        return static_cast<rive::ViewModelInstanceValue*>(m_resolvedValues[slot]);
+    }
+
+    rive::ViewModelInstanceValue* ViewModelInstance::TypedValueForSlot(int32_t slot, winrt::WinRive::ViewModelPropertyType type)
+    {
+        const auto* property = m_schema->At(slot);
+        return property && property->type == type ? ValueForSlot(slot) : nullptr;
+    }
+
+    rive::ViewModelInstanceValue* ViewModelInstance::TypedValue(hstring const& name, winrt::WinRive::ViewModelPropertyType type)
+    {
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+        return TypedValueForSlot(m_schema->IndexOf(name), type);
+    }
+#endif
+
+    Windows::Storage::Streams::IBuffer ViewModelInstance::Snapshot()
+    {
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+
+        ViewModelSnapshotWriter writer(m_schema->Fingerprint(), static_cast<uint32_t>(m_properties.size()));
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // Resolved here, read on the render thread between frames
+        std::vector<std::pair<rive::ViewModelInstanceValue*, winrt::WinRive::ViewModelPropertyType>> values(m_properties.size());
+        for (size_t slot = 0; slot < values.size(); ++slot)
+        {
+            values[slot] = { ValueForSlot(static_cast<int32_t>(slot)), m_schema->At(static_cast<int32_t>(slot))->type };
+        }
+
+        RunOnRenderThread([&writer, &values]()
+        {
+            for (const auto& [value, type] : values)
+            {
+                if (!value) {
+                    writer.AppendNone();
+                    continue;
+                }
+
+                switch (type) {
+                case winrt::WinRive::ViewModelPropertyType::String:
+                    writer.AppendString(static_cast<rive::ViewModelInstanceString*>(value)->propertyValue());
+                    break;
+                case winrt::WinRive::ViewModelPropertyType::Number:
+                    writer.AppendNumber(static_cast<float>(static_cast<rive::ViewModelInstanceNumber*>(value)->propertyValue()));
+                    break;
+                case winrt::WinRive::ViewModelPropertyType::Boolean:
+                    writer.AppendBoolean(static_cast<rive::ViewModelInstanceBoolean*>(value)->propertyValue());
+                    break;
+                case winrt::WinRive::ViewModelPropertyType::Color:
+                    writer.AppendColor(static_cast<uint32_t>(static_cast<rive::ViewModelInstanceColor*>(value)->propertyValue()));
+                    break;
+                case winrt::WinRive::ViewModelPropertyType::Enum:
+                    writer.AppendEnum(static_cast<uint32_t>(static_cast<rive::ViewModelInstanceEnum*>(value)->propertyValue()));
+                    break;
+                default:
+                    // Triggers, lists and nested instances hold no restorable value
+                    writer.AppendNone();
+                    break;
+                }
+            }
+        });
+#else
+        for (size_t slot = 0; slot < m_properties.size(); ++slot)
+        {
+            writer.AppendNone();
+        }
+#endif
+
+        const auto& blob = writer.Bytes();
+        Windows::Storage::Streams::Buffer buffer(static_cast<uint32_t>(blob.size()));
+        memcpy(buffer.data(), blob.data(), blob.size());
+        buffer.Length(static_cast<uint32_t>(blob.size()));
+        return buffer;
+    }
+
+    winrt::WinRive::ViewModelRestoreResult ViewModelInstance::Restore(Windows::Storage::Streams::IBuffer const& snapshot)
+    {
+        using Result = winrt::WinRive::ViewModelRestoreResult;
+        if (!snapshot)
+        {
+            return Result::Malformed;
+        }
+
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+
+        // Decoded whole before touching the instance, so a truncated or
+        // mismatched blob changes nothing
+        std::vector<ViewModelSnapshotValue> values;
+        switch (DecodeViewModelSnapshot(snapshot.data(), snapshot.Length(), m_schema->Fingerprint(),
+            static_cast<uint32_t>(m_properties.size()), values))
+        {
+        case ViewModelSnapshotStatus::Ok:
+            break;
+        case ViewModelSnapshotStatus::SchemaMismatch:
+            return Result::SchemaMismatch;
+        default:
+            return Result::Malformed;
+        }
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        std::vector<std::pair<int32_t, rive::ViewModelInstanceValue*>> targets;
+        targets.reserve(values.size());
+        for (int32_t slot = 0; slot < static_cast<int32_t>(values.size()); ++slot)
+        {
+            auto tag = values[slot].tag;
+            if (tag == ViewModelSnapshotTag::None)
+            {
+                continue;
+            }
+
+            winrt::WinRive::ViewModelPropertyType type;
+            switch (tag)
+            {
+            case ViewModelSnapshotTag::String: type = winrt::WinRive::ViewModelPropertyType::String; break;
+            case ViewModelSnapshotTag::Number: type = winrt::WinRive::ViewModelPropertyType::Number; break;
+            case ViewModelSnapshotTag::Boolean: type = winrt::WinRive::ViewModelPropertyType::Boolean; break;
+            case ViewModelSnapshotTag::Color: type = winrt::WinRive::ViewModelPropertyType::Color; break;
+            default: type = winrt::WinRive::ViewModelPropertyType::Enum; break;
+            }
+
+            auto* property = TypedValueForSlot(slot, type);
+            if (!property)
+            {
+                return Result::TypeMismatch;
+            }
+            targets.emplace_back(slot, property);
+        }
+
+        // One transaction: a single render thread command and one change set
+        BeginUpdate();
+        for (auto& [slot, property] : targets)
+        {
+            auto& value = values[slot];
+            SubmitWrite(slot, property, value.number, std::move(value.text));
+        }
+        Commit();
+        return Result::Restored;
+#else
+        return values.empty() ? Result::Restored : Result::TypeMismatch;
+#endif
+    }
+
+    winrt::WinRive::ViewModelInstance ViewModelInstance::NestedInstanceAt(int32_t slot)
+    {
+        if (slot < 0)
+        {
+            return nullptr;
+        }
+
+        if (m_nestedInstances.size() != m_properties.size())
+        {
+            m_nestedInstances.resize(m_properties.size(), nullptr);
+        }
+        if (slot >= static_cast<int32_t>(m_nestedInstances.size()))
+        {
+            return nullptr;
+        }
+        if (m_nestedInstances[slot])
+        {
+            if (!winrt::get_self<ViewModelInstance>(m_nestedInstances[slot])->IsDetached(false))
+            {
+                return m_nestedInstances[slot];
+            }
+            // The property was re-pointed behind our back; wrap what it holds now
+            m_nestedInstances[slot] = nullptr;
+        }
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        auto* value = static_cast<rive::ViewModelInstanceViewModel*>(TypedValueForSlot(slot, winrt::WinRive::ViewModelPropertyType::ViewModel));
+        if (!value)
+        {
+            return nullptr;
+        }
+
+        rive::rcp<rive::ViewModelInstance> nested;
+        RunOnRenderThread([&]()
+        {
+            nested = value->referenceViewModelInstance();
+        });
+        if (!nested)
+        {
+            return nullptr;
+        }
+
+        winrt::WinRive::ViewModel viewModel{ nullptr };
+        if (auto* nativeViewModel = nested->viewModel())
+        {
+            viewModel = winrt::make<implementation::ViewModel>(winrt::to_hstring(nativeViewModel->name()), -1, -1);
+            viewModel.as<implementation::ViewModel>()->SetNativeViewModel(nativeViewModel);
+        }
+
+        auto wrapper = winrt::make<implementation::ViewModelInstance>(viewModel);
+        auto* wrapperImpl = winrt::get_self<ViewModelInstance>(wrapper);
+        wrapperImpl->SetNativeInstance(nested.get());
+        wrapperImpl->SetCommandQueue(m_commandQueue);
+        wrapperImpl->m_nestingEpoch = m_nestingEpoch;
+        wrapperImpl->m_nestedLinks = m_nestedLinks.Extend({ rive::ref_rcp(static_cast<rive::ViewModelInstance*>(m_nativeInstance)), value,
+            nested.get() });
+        // Held for as long as the wrapper, so it outlives being replaced
+        wrapperImpl->RegisterWith(m_registry);
+        m_nestedInstances[slot] = wrapper;
+        return wrapper;
+#else
+        return nullptr;
+#endif
+    }
+
+    winrt::WinRive::ViewModelInstance ViewModelInstance::WalkNested(std::vector<hstring> const& segments, size_t count, int32_t* rootSlot)
+    {
+        winrt::WinRive::ViewModelInstance current = *this;
+        for (size_t i = 0; i < count && current; ++i)
+        {
+            auto* currentImpl = winrt::get_self<ViewModelInstance>(current);
+            if (!currentImpl->m_propertiesCached)
+            {
+                currentImpl->CacheProperties();
+            }
+
+            int32_t slot = currentImpl->m_schema->IndexOf(segments[i]);
+            if (i == 0 && rootSlot)
+            {
+                *rootSlot = slot;
+            }
+            current = currentImpl->NestedInstanceAt(slot);
+        }
+        return current;
+    }
+
+    bool ViewModelInstance::ResolveCompiledPath(CompiledPath& compiled)
+    {
+        compiled.leaf = WalkNested(compiled.segments, compiled.segments.size() - 1, &compiled.rootSlot);
+        compiled.leafHandle = compiled.leaf
+            ? winrt::get_self<ViewModelInstance>(compiled.leaf)->GetPropertyHandle(compiled.segments.back())
+            : kInvalidPropertyHandle;
+        if (compiled.leafHandle == kInvalidPropertyHandle)
+        {
+            compiled.leaf = nullptr;
+            return false;
+        }
+        compiled.epoch = m_nestingEpoch.Value();
+        return true;
+    }
+
+    bool ViewModelInstance::ReplaceNested(hstring const& name, winrt::WinRive::ViewModelInstance const& instance)
+    {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+
+        int32_t slot = m_schema->IndexOf(name);
+        auto* value = static_cast<rive::ViewModelInstanceViewModel*>(TypedValueForSlot(slot, winrt::WinRive::ViewModelPropertyType::ViewModel));
+        auto* replacement = static_cast<rive::ViewModelInstance*>(winrt::get_self<ViewModelInstance>(instance)->GetNativeInstance());
+        if (!value || !replacement)
+        {
+            return false;
+        }
+
+        // Only an instance of the view model the property refers to fits
+        bool compatible = false;
+        RunOnRenderThread([&]()
+        {
+            auto current = value->referenceViewModelInstance();
+            compatible = !current || current->viewModel() == replacement->viewModel();
+        });
+        if (!compatible)
+        {
+            return false;
+        }
+
+        PostWrite([keepAlive = rive::ref_rcp(static_cast<rive::ViewModelInstance*>(m_nativeInstance)), links = m_nestedLinks, value,
+            nested = rive::ref_rcp(replacement)]()
+        {
+            if (links.Current())
+            {
+                value->referenceViewModelInstance(nested);
+            }
+        });
+
+        // The old instance's wrapper and every path compiled through it are stale
+        if (slot < static_cast<int32_t>(m_nestedInstances.size()))
+        {
+            m_nestedInstances[slot] = nullptr;
+        }
+        m_nestingEpoch.Advance();
+        RaisePropertyChanged(slot);
+        return true;
+#else
+        (void)name; (void)instance; // Unused parameters when Rive headers not available
+        return false;
+#endif
+    }
+
+    ViewModelInstance* ViewModelInstance::ResolvePathHandle(uint64_t& handle)
+    {
+        if (!PropertyHandles::IsPath(handle))
+        {
+            return this;
+        }
+
+        if (!m_propertiesCached)
+        {
+            CacheProperties();
+        }
+
+        int32_t index = m_handles.PathOf(handle, m_compiledPaths.size());
+        if (index < 0)
+        {
+            return nullptr;
+        }
+
+        // A counter and the leaf's detached flags while nothing along the
+        // chain has changed
+        auto& compiled = m_compiledPaths[index];
+        bool current = compiled.leaf && m_nestingEpoch.IsCurrent(compiled.epoch) &&
+            !winrt::get_self<ViewModelInstance>(compiled.leaf)->IsDetached(true);
+        if (!current && !ResolveCompiledPath(compiled))
+        {
+            return nullptr;
+        }
+        handle = compiled.leafHandle;
+        return winrt::get_self<ViewModelInstance>(compiled.leaf);
+    }
+
+    ViewModelInstance* ViewModelInstance::WriteTargetForHandle(uint64_t& handle)
+    {
+        auto* target = ResolvePathHandle(handle);
+        // A path write inside an update joins it through an update of its own
+        // on the nested instance, committed by ours
+        if (target && target != this && m_updateDepth > 0 && target->m_updateDepth == 0)
+        {
+            target->BeginUpdate();
+            m_updatingNested.push_back(target->get_strong());
+        }
+        return target;
+    }
+
+    bool ViewModelInstance::IsValid() const
+    {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        return m_nativeInstance != nullptr;
+#else
+        return m_viewModel != nullptr;
+#endif
+    }
+
+    winrt::event_token ViewModelInstance::PropertyChanged(Windows::Foundation::TypedEventHandler<winrt::WinRive::ViewModelInstance, winrt::WinRive::ViewModelInstanceProperty> const& handler)
+    {
+        return m_propertyChangedEvent.add(handler);
+    }
+
+    void ViewModelInstance::PropertyChanged(winrt::event_token const& token) noexcept
+    {
+        m_propertyChangedEvent.remove(token);
+    }
+
+    void ViewModelInstance::SetCommandQueue(std::shared_ptr<RenderCommandQueue> commandQueue)
+    {
+        m_commandQueue = std::move(commandQueue);
+    }
+
+    void ViewModelInstance::PostWrite(std::function<void()> write)
+    {
+        // Unattached instances aren't drawn by anyone, so write straight through
+        if (m_commandQueue)
+        {
+            m_commandQueue->Post(std::move(write));
+        }
+        else
+        {
+            write();
+        }
+    }
+
+    void ViewModelInstance::RunOnRenderThread(std::function<void()> const& read)
+    {
+        // Runs between frames, or right here when nothing is rendering; a
+        // queue closed under us means the renderer is gone, so read directly
+        if (m_commandQueue)
+        {
+            auto completion = m_commandQueue->PostWithCompletion([&read]() { read(); return true; });
+            if (completion->Wait())
+            {
+                return;
+            }
+        }
+        read();
+    }
+
+    void ViewModelInstance::AdoptRegistryReference(std::shared_ptr<ViewModelInstanceRegistry> registry, uint32_t handle)
+    {
+        if (m_registry)
+        {
+            m_registry->Release(m_registryHandle);
+        }
+        m_registry = std::move(registry);
+        m_registryHandle = handle;
+    }
+
+    bool ViewModelInstance::IsDetached(bool anyLevel) const
+    {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        return m_nestedLinks.IsDetached(anyLevel);
+#else
+        (void)anyLevel; // Unused parameter when Rive headers not available
+        return false;
+#endif
+    }
+
+    void ViewModelInstance::RegisterWith(std::shared_ptr<ViewModelInstanceRegistry> registry)
+    {
+        if (!registry)
+        {
+            return;
+        }
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // Kept even if the registry is full, so wrappers made from this one
+        // still have a registry to register with
+        auto handle = m_nativeInstance
+            ? registry->Add(rive::ref_rcp(static_cast<rive::ViewModelInstance*>(m_nativeInstance)))
+            : ViewModelInstanceRegistry::kInvalidHandle;
+        AdoptRegistryReference(std::move(registry), handle);
+#endif
+    }
+
+    void* ViewModelInstance::GetNativeInstance() const
+    {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        return m_nativeInstance;
+#else
+        return nullptr;
+#endif
+    }
+
+    void ViewModelInstance::SetNativeInstance(void* nativeInstance)
+    {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        m_nativeInstance = nativeInstance;
+        InvalidatePropertyCache(); // Force re-cache of properties when native instance changes
+#else
+        // Unused when rive headers not available
+        (void)nativeInstance;
+#endif
+    }
+
+    void ViewModelInstance::InvalidatePropertyCache()
+    {
+        m_propertiesCached = false;
+        m_properties.clear();
+        m_propertiesView = nullptr;
+        m_schema = nullptr;
+        m_lists.clear();
+        m_resolvedValues.clear();
+        m_slotResolved.clear();
+        m_valueSlots.clear();
+        m_valueSlotsBuilt = false;
+        m_handles.NewGeneration();
+
+        // Nested wrappers and paths through them belong to the previous
+        // instance, and so do any compiled by the instances above this one
+        m_nestedInstances.clear();
+        m_compiledPaths.clear();
+        m_compiledPathIndex.clear();
+        m_nestingEpoch.Advance();
+
+        // Staged writes point into the previous native instance
+        m_stagedWrites.clear();
+        m_stagedStrings.clear();
+        m_stagedSlots.clear();
+        m_slotStaged.clear();
+
+        // Pending slots refer to the previous layout
+        if (m_changeCoalescer)
+        {
+            m_changeCoalescer->Clear();
+        }
+    }
+
+    void ViewModelInstance::CacheProperties() const
+    {
+        m_properties.clear();
+        m_schema = ViewModelSchema::Empty();
+
+        if (IsValid() && m_viewModel)
+        {
+            m_schema = m_viewModel.as<implementation::ViewModel>()->Schema();
+
+            // One wrapper per schema slot, so a name lookup in the schema
+            // indexes straight into m_properties
+            m_properties.reserve(m_schema->Count());
+            for (int32_t slot = 0; slot < m_schema->Count(); ++slot)
+            {
+                const auto* property = m_schema->At(slot);
+                m_properties.push_back(CreatePropertyWrapper(property->index, property->name, property->type));
+            }
+        }
+
+        m_resolvedValues.assign(m_properties.size(), nullptr);
+        m_slotResolved.assign(m_properties.size(), false);
+        m_slotStaged.assign(m_properties.size(), false);
 
+        m_propertiesView = winrt::single_threaded_vector<winrt::WinRive::ViewModelInstanceProperty>(
+            std::vector<winrt::WinRive::ViewModelInstanceProperty>(m_properties)).GetView();
         m_propertiesCached = true;
     }
 
-    winrt::WinRive::ViewModelInstanceProperty ViewModelInstance::CreatePropertyWrapper(int32_t index, hstring const& name) const
+    winrt::WinRive::ViewModelInstanceProperty ViewModelInstance::CreatePropertyWrapper(int32_t index, hstring const& name,
+        winrt::WinRive::ViewModelPropertyType type) const
     {
         // Create a new ViewModelInstanceProperty that references this instance
         auto propertyImpl = winrt::make<implementation::ViewModelInstanceProperty>(
             name, 
             index, 
+            type,
             *this
         );
         
@@ -1,9 +1,13 @@
 #pragma once
 #include "ViewModelInstance.g.h"
 #include "ViewModel.h"
+#include "PropertyChangeCoalescer.h"
+#include "../../shared/property_handles.h"
+#include "../../shared/nested_chain.h"
 
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
 #include "rive/viewmodel/viewmodel_instance.hpp"
+#include "rive/viewmodel/viewmodel_instance_viewmodel.hpp"
 #endif
 
 namespace winrt::WinRive::implementation
@@ -12,6 +16,7 @@ namespace winrt::WinRive::implementation
     {
         ViewModelInstance() = default;
         ViewModelInstance(winrt::WinRive::ViewModel const& viewModel);
+        ~ViewModelInstance();
 
         // Associated view model
         winrt::WinRive::ViewModel ViewModel();
@@ -30,17 +35,75 @@ namespace winrt::WinRive::implementation
         bool SetEnumProperty(hstring const& name, int32_t value);
         bool FireTrigger(hstring const& name);
 
+        // Property handles
+        static constexpr uint64_t kInvalidPropertyHandle = 0;
+        uint64_t GetPropertyHandle(hstring const& name);
+        bool SetStringPropertyByHandle(uint64_t handle, hstring const& value);
+        bool SetNumberPropertyByHandle(uint64_t handle, double value);
+        bool SetBooleanPropertyByHandle(uint64_t handle, bool value);
+        bool SetColorPropertyByHandle(uint64_t handle, uint32_t color);
+        bool SetEnumPropertyByHandle(uint64_t handle, int32_t value);
+        bool FireTriggerByHandle(uint64_t handle);
+
+        // Transactional updates
+        void BeginUpdate();
+        void Commit();
+
+        // List properties
+        winrt::WinRive::ViewModelList GetList(hstring const& name);
+
+        // Nested view models
+        uint64_t CompilePath(hstring const& path);
+        winrt::WinRive::ViewModelInstance GetNestedInstance(hstring const& path);
+        bool SetNestedInstance(hstring const& path, winrt::WinRive::ViewModelInstance const& instance);
+
+        // Bulk state
+        Windows::Storage::Streams::IBuffer Snapshot();
+        winrt::WinRive::ViewModelRestoreResult Restore(Windows::Storage::Streams::IBuffer const& snapshot);
+
+        // Change notification delivery
+        void SetChangeCoalescing(int32_t intervalMilliseconds);
+        void FlushPropertyChanges();
+
         // Validation
         bool IsValid() const;
 
         // Events
         winrt::event_token PropertyChanged(Windows::Foundation::TypedEventHandler<winrt::WinRive::ViewModelInstance, winrt::WinRive::ViewModelInstanceProperty> const& handler);
         void PropertyChanged(winrt::event_token const& token) noexcept;
+        winrt::event_token PropertiesChanged(Windows::Foundation::TypedEventHandler<winrt::WinRive::ViewModelInstance, Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelInstanceProperty>> const& handler);
+        void PropertiesChanged(winrt::event_token const& token) noexcept;
 
         // Internal methods
         void* GetNativeInstance() const;
         void SetNativeInstance(void* nativeInstance);
         void InvalidatePropertyCache();
+        // Route native writes through the owning renderer's command queue
+        void SetCommandQueue(std::shared_ptr<RenderCommandQueue> commandQueue);
+        // Take over the registry reference that keeps the native instance alive
+        void AdoptRegistryReference(std::shared_ptr<ViewModelInstanceRegistry> registry, uint32_t handle);
+        // Take a new registry reference on the native instance, for wrappers
+        // of instances the host didn't create (reloads, nested, list items)
+        void RegisterWith(std::shared_ptr<ViewModelInstanceRegistry> registry);
+        // Between BeginUpdate and the outermost Commit
+        bool IsUpdating() const { return m_updateDepth > 0; }
+        // Called once the outermost Commit has posted its writes and raised
+        // its own events; lets the owning control report the batch once
+        void SetCommittedCallback(std::function<void()> callback);
+        // Wrapper of the property a handle refers to, or null
+        winrt::WinRive::ViewModelInstanceProperty PropertyForHandle(uint64_t handle);
+        winrt::WinRive::ViewModelInstanceProperty PropertyAt(int32_t slot);
+        int32_t SlotForHandle(uint64_t handle);
+        // Slot of this instance a write lands under - the property itself, or
+        // for a path handle the nested view model property it starts with
+        int32_t RootSlotForHandle(uint64_t handle);
+        // Slot of the native instance's propertyValues()[valueIndex], matched
+        // by name; -1 when the schema has no such property
+        int32_t SlotForValueIndex(uint32_t valueIndex);
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // Native value of the named property, or null unless it has this type
+        rive::ViewModelInstanceValue* TypedValue(hstring const& name, winrt::WinRive::ViewModelPropertyType type);
+#endif
 
     private:
         winrt::WinRive::ViewModel m_viewModel{ nullptr };
@@ -48,16 +111,137 @@ namespace winrt::WinRive::implementation
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
         void* m_nativeInstance{ nullptr };
 #endif
+        std::shared_ptr<RenderCommandQueue> m_commandQueue;
+        std::shared_ptr<ViewModelInstanceRegistry> m_registry;
+        uint32_t m_registryHandle{ 0 };
 
-        // Property cache
+        // Property wrappers, one per schema slot, built once per native instance.
+        // The schema is shared with every other instance of the view model.
+        mutable std::shared_ptr<const ViewModelSchema> m_schema;
         mutable std::vector<winrt::WinRive::ViewModelInstanceProperty> m_properties;
+        mutable Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelInstanceProperty> m_propertiesView{ nullptr };
         mutable bool m_propertiesCached{ false };
 
+        // Native values resolved through handles, per schema slot. Handles
+        // get a new generation on every SetNativeInstance, so a handle is
+        // rejected once its instance was re-pointed and by every other
+        // wrapper (see PropertyHandles).
+        mutable std::vector<void*> m_resolvedValues;   // rive::ViewModelInstanceValue*
+        mutable std::vector<bool> m_slotResolved;
+        // Schema slot per native value index, built on first SlotForValueIndex
+        std::vector<int32_t> m_valueSlots;
+        bool m_valueSlotsBuilt{ false };
+        PropertyHandles m_handles;
+
+        // Writes made between BeginUpdate and Commit. Values are held as a
+        // double (number, boolean, color, enum) or an index into the string
+        // list, and applied in order by one render thread command.
+        static constexpr uint32_t kNoStagedString = UINT32_MAX;
+        struct StagedWrite
+        {
+            void* property;   // rive::ViewModelInstanceValue*
+            winrt::WinRive::ViewModelPropertyType type;
+            double number;
+            uint32_t stringIndex;
+        };
+        int32_t m_updateDepth{ 0 };
+        std::vector<StagedWrite> m_stagedWrites;
+        std::vector<std::string> m_stagedStrings;
+        std::vector<int32_t> m_stagedSlots;   // Changed slots, first-write order
+        mutable std::vector<bool> m_slotStaged;
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // One level of the chain a nested wrapper was reached by: the parent's
+        // view model property and the instance it referred to then. The file
+        // can re-point a property without going through ReplaceNested, so the
+        // chain is checked on the render thread before each write (see
+        // NestedChain).
+        struct NestedLink
+        {
+            rive::rcp<rive::ViewModelInstance> owner;   // Keeps value alive
+            rive::ViewModelInstanceViewModel* value;
+            rive::ViewModelInstance* instance;
+
+            bool IsCurrent() const { return value->referenceViewModelInstance().get() == instance; }
+        };
+        // Empty unless this wrapper came from NestedInstanceAt
+        NestedChain<NestedLink> m_nestedLinks;
+#endif
+        // What one instance contributes to a Commit
+        struct StagedUpdate
+        {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+            rive::rcp<rive::ViewModelInstance> instance;
+            NestedChain<NestedLink> links;
+#endif
+            std::vector<StagedWrite> writes;
+            std::vector<std::string> strings;
+        };
+
+        // List wrappers by slot, made on first GetList
+        std::vector<winrt::WinRive::ViewModelList> m_lists;
+
+        // Nested view model wrappers by slot, made on first use. They share
+        // m_nestingEpoch; compiled paths resolve again when it has moved
+        // since they were resolved, or when a write found their chain
+        // re-pointed (see NestedChain).
+        // Path handles index m_compiledPaths instead of a slot.
+        struct CompiledPath
+        {
+            std::vector<hstring> segments;
+            int32_t rootSlot{ -1 };
+            uint32_t epoch{ 0 };
+            winrt::WinRive::ViewModelInstance leaf{ nullptr };
+            uint64_t leafHandle{ kInvalidPropertyHandle };
+        };
+        std::vector<winrt::WinRive::ViewModelInstance> m_nestedInstances;
+        NestingEpoch m_nestingEpoch;
+        std::vector<CompiledPath> m_compiledPaths;
+        std::unordered_map<hstring, uint32_t> m_compiledPathIndex;
+        // Nested wrappers a path write pulled into the current update
+        std::vector<winrt::com_ptr<ViewModelInstance>> m_updatingNested;
+        std::function<void()> m_committedCallback;
+
+        // Set while change events are deferred (see SetChangeCoalescing)
+        std::unique_ptr<PropertyChangeCoalescer> m_changeCoalescer;
+
         // Events
         winrt::event<Windows::Foundation::TypedEventHandler<winrt::WinRive::ViewModelInstance, winrt::WinRive::ViewModelInstanceProperty>> m_propertyChangedEvent;
+        winrt::event<Windows::Foundation::TypedEventHandler<winrt::WinRive::ViewModelInstance, Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelInstanceProperty>>> m_propertiesChangedEvent;
 
         void CacheProperties() const;
-        winrt::WinRive::ViewModelInstanceProperty CreatePropertyWrapper(int32_t index, hstring const& name) const;
+        void PostWrite(std::function<void()> write);
+        // Ends the update here and on the nested instances it pulled in,
+        // moving their staged writes into updates in the order they apply
+        void CollectCommit(std::vector<StagedUpdate>& updates,
+            std::vector<winrt::com_ptr<ViewModelInstance>>& committed);
+        void RaiseCommittedChanges();
+        void RunOnRenderThread(std::function<void()> const& read);
+        void RaisePropertyChanged(int32_t slot);
+        // PropertyChanged for each slot, then one PropertiesChanged
+        void DeliverPropertyChanges(std::vector<int32_t> const& slots);
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        rive::ViewModelInstanceValue* ValueForSlot(int32_t slot);
+        // Null unless the schema gives the slot this type
+        rive::ViewModelInstanceValue* TypedValueForSlot(int32_t slot, winrt::WinRive::ViewModelPropertyType type);
+        void SubmitWrite(int32_t slot, rive::ViewModelInstanceValue* property, double number, std::string text);
+        static void WriteNativeValue(rive::ViewModelInstanceValue* property, winrt::WinRive::ViewModelPropertyType type,
+            double number, std::string const& text);
+#endif
+        // Whether a write found this wrapper's own level re-pointed, or with
+        // anyLevel whether it found any level above it re-pointed
+        bool IsDetached(bool anyLevel) const;
+        winrt::WinRive::ViewModelInstanceProperty CreatePropertyWrapper(int32_t index, hstring const& name,
+            winrt::WinRive::ViewModelPropertyType type) const;
+        winrt::WinRive::ViewModelInstance NestedInstanceAt(int32_t slot);
+        // Follows the first count segments as nested view model properties;
+        // null when one of them isn't
+        winrt::WinRive::ViewModelInstance WalkNested(std::vector<hstring> const& segments, size_t count, int32_t* rootSlot);
+        bool ResolveCompiledPath(CompiledPath& compiled);
+        bool ReplaceNested(hstring const& name, winrt::WinRive::ViewModelInstance const& instance);
+        // Instance and handle a path handle currently leads to; this instance
+        // and the handle unchanged for plain handles, null when unresolvable
+        ViewModelInstance* ResolvePathHandle(uint64_t& handle);
+        ViewModelInstance* WriteTargetForHandle(uint64_t& handle);
     };
 }
 
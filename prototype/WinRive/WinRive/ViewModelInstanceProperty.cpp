@@ -5,21 +5,10 @@
 
 namespace winrt::WinRive::implementation
 {
-    ViewModelInstanceProperty::ViewModelInstanceProperty(hstring const& name, int32_t index, winrt::WinRive::ViewModelInstance const& parentInstance)
-        : m_name(name), m_index(index), m_parentInstance(parentInstance)
+    ViewModelInstanceProperty::ViewModelInstanceProperty(hstring const& name, int32_t index, winrt::WinRive::ViewModelPropertyType type,
+        winrt::WinRive::ViewModelInstance const& parentInstance)
+        : m_name(name), m_index(index), m_type(type), m_parentInstance(parentInstance)
     {
-        // Determine type from parent view model
-        if (auto parent = m_parentInstance.get())
-        {
-            if (auto viewModel = parent.ViewModel())
-            {
-                auto propInfo = viewModel.GetPropertyByName(name);
-                if (!propInfo.Name.empty())
-                {
-                    m_type = propInfo.Type;
-                }
-            }
-        }
     }
 
     hstring ViewModelInstanceProperty::Name()
@@ -120,22 +109,11 @@ namespace winrt::WinRive::implementation
         if (!parent) return L"";
 
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-        // Access the native instance through the implementation
+        // The parent checks the schema type, so the cast below is safe
         auto parentImpl = winrt::get_self<winrt::WinRive::implementation::ViewModelInstance>(parent);
-        if (parentImpl) {
-            auto nativeInstance = parentImpl->GetNativeInstance();
-            if (nativeInstance) {
-                auto* riveInstance = static_cast<rive::ViewModelInstance*>(nativeInstance);
-                std::string propName = winrt::to_string(m_name);
-                
-                auto property = riveInstance->propertyValue(propName);
-                if (property) {
-                    auto stringProperty = static_cast<rive::ViewModelInstanceString*>(property);
-                    if (stringProperty) {
-                        return winrt::to_hstring(stringProperty->propertyValue());
-                    }
-                }
-            }
+        auto stringProperty = static_cast<rive::ViewModelInstanceString*>(parentImpl->TypedValue(m_name, winrt::WinRive::ViewModelPropertyType::String));
+        if (stringProperty) {
+            return winrt::to_hstring(stringProperty->propertyValue());
         }
 #endif
 
@@ -163,21 +141,11 @@ namespace winrt::WinRive::implementation
         if (!parent) return 0.0;
 
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // The parent checks the schema type, so the cast below is safe
         auto parentImpl = winrt::get_self<winrt::WinRive::implementation::ViewModelInstance>(parent);
-        if (parentImpl) {
-            auto nativeInstance = parentImpl->GetNativeInstance();
-            if (nativeInstance) {
-                auto* riveInstance = static_cast<rive::ViewModelInstance*>(nativeInstance);
-                std::string propName = winrt::to_string(m_name);
-                
-                auto property = riveInstance->propertyValue(propName);
-                if (property) {
-                    auto numberProperty = static_cast<rive::ViewModelInstanceNumber*>(property);
-                    if (numberProperty) {
-                        return static_cast<double>(numberProperty->propertyValue());
-                    }
-                }
-            }
+        auto numberProperty = static_cast<rive::ViewModelInstanceNumber*>(parentImpl->TypedValue(m_name, winrt::WinRive::ViewModelPropertyType::Number));
+        if (numberProperty) {
+            return static_cast<double>(numberProperty->propertyValue());
         }
 #endif
 
@@ -205,21 +173,11 @@ namespace winrt::WinRive::implementation
         if (!parent) return false;
 
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // The parent checks the schema type, so the cast below is safe
         auto parentImpl = winrt::get_self<winrt::WinRive::implementation::ViewModelInstance>(parent);
-        if (parentImpl) {
-            auto nativeInstance = parentImpl->GetNativeInstance();
-            if (nativeInstance) {
-                auto* riveInstance = static_cast<rive::ViewModelInstance*>(nativeInstance);
-                std::string propName = winrt::to_string(m_name);
-                
-                auto property = riveInstance->propertyValue(propName);
-                if (property) {
-                    auto boolProperty = static_cast<rive::ViewModelInstanceBoolean*>(property);
-                    if (boolProperty) {
-                        return boolProperty->propertyValue();
-                    }
-                }
-            }
+        auto boolProperty = static_cast<rive::ViewModelInstanceBoolean*>(parentImpl->TypedValue(m_name, winrt::WinRive::ViewModelPropertyType::Boolean));
+        if (boolProperty) {
+            return boolProperty->propertyValue();
         }
 #endif
 
@@ -247,21 +205,11 @@ namespace winrt::WinRive::implementation
         if (!parent) return 0;
 
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // The parent checks the schema type, so the cast below is safe
         auto parentImpl = winrt::get_self<winrt::WinRive::implementation::ViewModelInstance>(parent);
-        if (parentImpl) {
-            auto nativeInstance = parentImpl->GetNativeInstance();
-            if (nativeInstance) {
-                auto* riveInstance = static_cast<rive::ViewModelInstance*>(nativeInstance);
-                std::string propName = winrt::to_string(m_name);
-                
-                auto property = riveInstance->propertyValue(propName);
-                if (property) {
-                    auto colorProperty = static_cast<rive::ViewModelInstanceColor*>(property);
-                    if (colorProperty) {
-                        return colorProperty->propertyValue();
-                    }
-                }
-            }
+        auto colorProperty = static_cast<rive::ViewModelInstanceColor*>(parentImpl->TypedValue(m_name, winrt::WinRive::ViewModelPropertyType::Color));
+        if (colorProperty) {
+            return colorProperty->propertyValue();
         }
 #endif
 
@@ -289,21 +237,11 @@ namespace winrt::WinRive::implementation
         if (!parent) return 0;
 
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // The parent checks the schema type, so the cast below is safe
         auto parentImpl = winrt::get_self<winrt::WinRive::implementation::ViewModelInstance>(parent);
-        if (parentImpl) {
-            auto nativeInstance = parentImpl->GetNativeInstance();
-            if (nativeInstance) {
-                auto* riveInstance = static_cast<rive::ViewModelInstance*>(nativeInstance);
-                std::string propName = winrt::to_string(m_name);
-                
-                auto property = riveInstance->propertyValue(propName);
-                if (property) {
-                    auto enumProperty = static_cast<rive::ViewModelInstanceEnum*>(property);
-                    if (enumProperty) {
-                        return static_cast<int32_t>(enumProperty->propertyValue());
-                    }
-                }
-            }
+        auto enumProperty = static_cast<rive::ViewModelInstanceEnum*>(parentImpl->TypedValue(m_name, winrt::WinRive::ViewModelPropertyType::Enum));
+        if (enumProperty) {
+            return static_cast<int32_t>(enumProperty->propertyValue());
         }
 #endif
 
@@ -6,7 +6,8 @@ namespace winrt::WinRive::implementation
     struct ViewModelInstanceProperty : ViewModelInstancePropertyT<ViewModelInstanceProperty>
     {
         ViewModelInstanceProperty() = default;
-        ViewModelInstanceProperty(hstring const& name, int32_t index, winrt::WinRive::ViewModelInstance const& parentInstance);
+        ViewModelInstanceProperty(hstring const& name, int32_t index, winrt::WinRive::ViewModelPropertyType type,
+            winrt::WinRive::ViewModelInstance const& parentInstance);
 
         // Basic info
         hstring Name();
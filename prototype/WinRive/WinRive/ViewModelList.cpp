@@ -0,0 +1,288 @@
+#include "pch.h"
+#include "ViewModelList.h"
+#include "ViewModelList.g.cpp"
+#include "ViewModel.h"
+#include "ViewModelInstance.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+namespace winrt::WinRive::implementation
+{
+    hstring ViewModelList::Name()
+    {
+        return m_name;
+    }
+
+    int32_t ViewModelList::Count()
+    {
+        return static_cast<int32_t>(m_items.size());
+    }
+
+    winrt::WinRive::ViewModelInstance ViewModelList::GetAt(int32_t index)
+    {
+        if (index < 0 || index >= Count())
+        {
+            return nullptr;
+        }
+
+        auto& entry = m_items[index];
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // Items that came from the file have no wrapper until asked for
+        if (!entry.wrapper && entry.nativeInstance)
+        {
+            winrt::WinRive::ViewModel viewModel{ nullptr };
+            if (auto* nativeViewModel = entry.nativeInstance->viewModel())
+            {
+                viewModel = winrt::make<implementation::ViewModel>(winrt::to_hstring(nativeViewModel->name()), -1, -1);
+                viewModel.as<implementation::ViewModel>()->SetNativeViewModel(nativeViewModel);
+            }
+
+            auto wrapper = winrt::make<implementation::ViewModelInstance>(viewModel);
+            wrapper.as<implementation::ViewModelInstance>()->SetNativeInstance(entry.nativeInstance.get());
+            wrapper.as<implementation::ViewModelInstance>()->SetCommandQueue(m_commandQueue);
+            wrapper.as<implementation::ViewModelInstance>()->RegisterWith(m_registry);
+            entry.wrapper = wrapper.as<winrt::WinRive::ViewModelInstance>();
+        }
+#endif
+        return entry.wrapper;
+    }
+
+    bool ViewModelList::InsertRange(int32_t index, array_view<winrt::WinRive::ViewModelInstance const> items)
+    {
+        std::vector<Entry> entries;
+        if (index < 0 || index > Count() || !TakeItems(items, entries))
+        {
+            return false;
+        }
+
+        m_items.insert(m_items.begin() + index, std::make_move_iterator(entries.begin()), std::make_move_iterator(entries.end()));
+        Sync();
+        return true;
+    }
+
+    bool ViewModelList::RemoveRange(int32_t index, int32_t count)
+    {
+        // Subtracted rather than summed so a huge count can't wrap past the check
+        if (index < 0 || count < 0 || index > Count() || count > Count() - index)
+        {
+            return false;
+        }
+
+        m_items.erase(m_items.begin() + index, m_items.begin() + index + count);
+        Sync();
+        return true;
+    }
+
+    bool ViewModelList::MoveRange(int32_t index, int32_t count, int32_t destination)
+    {
+        // destination is where the first moved item ends up
+        if (index < 0 || count < 0 || index > Count() || count > Count() - index ||
+            destination < 0 || destination > Count() - count)
+        {
+            return false;
+        }
+
+        auto first = m_items.begin();
+        if (destination < index)
+        {
+            std::rotate(first + destination, first + index, first + index + count);
+        }
+        else if (destination > index)
+        {
+            std::rotate(first + index, first + index + count, first + destination + count);
+        }
+        Sync();
+        return true;
+    }
+
+    bool ViewModelList::ReplaceRange(int32_t index, array_view<winrt::WinRive::ViewModelInstance const> items)
+    {
+        std::vector<Entry> entries;
+        if (index < 0 || index > Count() || items.size() > static_cast<uint32_t>(Count() - index) ||
+            !TakeItems(items, entries))
+        {
+            return false;
+        }
+
+        std::move(entries.begin(), entries.end(), m_items.begin() + index);
+        Sync();
+        return true;
+    }
+
+    void ViewModelList::SetWindow(int32_t start, int32_t count)
+    {
+        m_windowStart = std::max(start, 0);
+        m_windowCount = count;
+        Sync();
+    }
+
+    int32_t ViewModelList::WindowStart()
+    {
+        return m_windowStart;
+    }
+
+    int32_t ViewModelList::WindowCount()
+    {
+        return m_windowCount;
+    }
+
+    int32_t ViewModelList::MaterializedCount()
+    {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        return static_cast<int32_t>(m_nativeItems.size());
+#else
+        return 0;
+#endif
+    }
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    void ViewModelList::Initialize(hstring const& name, rive::ViewModelInstance* owner, rive::ViewModelInstanceList* nativeList,
+        std::vector<rive::rcp<rive::ViewModelInstanceListItem>> existingItems,
+        std::shared_ptr<RenderCommandQueue> commandQueue, std::shared_ptr<ViewModelInstanceRegistry> registry)
+    {
+        m_name = name;
+        m_owner = owner;
+        m_nativeList = nativeList;
+        m_commandQueue = std::move(commandQueue);
+        m_registry = std::move(registry);
+
+        m_nativeItems = std::move(existingItems);
+        m_nativeInstances.clear();
+        m_items.clear();
+        for (const auto& item : m_nativeItems)
+        {
+            auto nativeInstance = item ? item->viewModelInstance() : nullptr;
+            m_nativeInstances.push_back(nativeInstance.get());
+            m_items.push_back({ std::move(nativeInstance) });
+        }
+    }
+#endif
+
+    bool ViewModelList::TakeItems(array_view<winrt::WinRive::ViewModelInstance const> items, std::vector<Entry>& entries) const
+    {
+        entries.reserve(items.size());
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        for (auto const& item : items)
+        {
+            auto* nativeInstance = item
+                ? static_cast<rive::ViewModelInstance*>(item.as<implementation::ViewModelInstance>()->GetNativeInstance())
+                : nullptr;
+            if (!nativeInstance)
+            {
+                return false;
+            }
+            entries.push_back({ rive::ref_rcp(nativeInstance), item });
+        }
+        return true;
+#else
+        // Without native instances there is nothing to place
+        return items.empty();
+#endif
+    }
+
+    void ViewModelList::Sync()
+    {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        if (!m_nativeList)
+        {
+            return;
+        }
+
+        int32_t start = std::min(m_windowStart, Count());
+        int32_t end = m_windowCount < 0 || m_windowCount > Count() - start ? Count() : start + m_windowCount;
+
+        std::vector<rive::ViewModelInstance*> desired;
+        desired.reserve(end - start);
+        for (int32_t i = start; i < end; ++i)
+        {
+            desired.push_back(m_items[i].nativeInstance.get());
+        }
+
+        struct Edit
+        {
+            bool insert;
+            int32_t index;
+            rive::rcp<rive::ViewModelInstanceListItem> item;
+        };
+        std::vector<Edit> edits;
+
+        // Drop what left the window, back to front so earlier indices hold
+        std::unordered_set<rive::ViewModelInstance*> wanted(desired.begin(), desired.end());
+        for (int32_t i = static_cast<int32_t>(m_nativeItems.size()) - 1; i >= 0; --i)
+        {
+            if (!wanted.count(m_nativeInstances[i]))
+            {
+                edits.push_back({ false, i, m_nativeItems[i] });
+                m_nativeItems.erase(m_nativeItems.begin() + i);
+                m_nativeInstances.erase(m_nativeInstances.begin() + i);
+            }
+        }
+
+        // Walk the window in order: matches stay, items further down are
+        // moved up, and anything new gets a fresh native item
+        for (int32_t i = 0; i < static_cast<int32_t>(desired.size()); ++i)
+        {
+            if (i < static_cast<int32_t>(m_nativeInstances.size()) && m_nativeInstances[i] == desired[i])
+            {
+                continue;
+            }
+
+            rive::rcp<rive::ViewModelInstanceListItem> item;
+            auto found = std::find(m_nativeInstances.begin() + std::min<size_t>(i, m_nativeInstances.size()), m_nativeInstances.end(), desired[i]);
+            if (found != m_nativeInstances.end())
+            {
+                int32_t from = static_cast<int32_t>(found - m_nativeInstances.begin());
+                item = m_nativeItems[from];
+                edits.push_back({ false, from, item });
+                m_nativeItems.erase(m_nativeItems.begin() + from);
+                m_nativeInstances.erase(found);
+            }
+            else
+            {
+                item = rive::make_rcp<rive::ViewModelInstanceListItem>();
+                item->viewModelInstance(m_items[start + i].nativeInstance);
+            }
+
+            edits.push_back({ true, i, item });
+            m_nativeItems.insert(m_nativeItems.begin() + i, item);
+            m_nativeInstances.insert(m_nativeInstances.begin() + i, desired[i]);
+        }
+
+        // Left over only when the same instance appears twice
+        while (m_nativeItems.size() > desired.size())
+        {
+            int32_t last = static_cast<int32_t>(m_nativeItems.size()) - 1;
+            edits.push_back({ false, last, m_nativeItems[last] });
+            m_nativeItems.pop_back();
+            m_nativeInstances.pop_back();
+        }
+
+        if (edits.empty())
+        {
+            return;
+        }
+
+        auto apply = [keepAlive = rive::ref_rcp(m_owner), list = m_nativeList, edits = std::move(edits)]()
+        {
+            for (const auto& edit : edits)
+            {
+                if (edit.insert) {
+                    list->addItemAt(edit.item.get(), edit.index);
+                } else {
+                    list->removeItem(edit.item.get());
+                }
+            }
+        };
+
+        if (m_commandQueue)
+        {
+            m_commandQueue->Post(std::move(apply));
+        }
+        else
+        {
+            apply();
+        }
+#endif
+    }
+}
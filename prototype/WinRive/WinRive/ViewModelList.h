@@ -0,0 +1,81 @@
+#pragma once
+#include "ViewModelList.g.h"
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+#include "rive/viewmodel/viewmodel_instance.hpp"
+#include "rive/viewmodel/viewmodel_instance_list.hpp"
+#include "rive/viewmodel/viewmodel_instance_list_item.hpp"
+#endif
+
+namespace winrt::WinRive::implementation
+{
+    // A list property of a view model instance. The host edits the whole
+    // logical list here, but only items inside the virtualization window are
+    // placed in the native list - the runtime instantiates artboards for
+    // native items only, so a long list costs what is visible. After each
+    // edit the native list is brought in line with the fewest removes and
+    // inserts, posted to the render thread as one command; items that stay
+    // keep their component instances.
+    struct ViewModelList : ViewModelListT<ViewModelList>
+    {
+        ViewModelList() = default;
+
+        hstring Name();
+        int32_t Count();
+        winrt::WinRive::ViewModelInstance GetAt(int32_t index);
+
+        // Range edits
+        bool InsertRange(int32_t index, array_view<winrt::WinRive::ViewModelInstance const> items);
+        bool RemoveRange(int32_t index, int32_t count);
+        bool MoveRange(int32_t index, int32_t count, int32_t destination);
+        bool ReplaceRange(int32_t index, array_view<winrt::WinRive::ViewModelInstance const> items);
+
+        // Virtualization window
+        void SetWindow(int32_t start, int32_t count);
+        int32_t WindowStart();
+        int32_t WindowCount();
+        int32_t MaterializedCount();
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        // Internal methods - adopt the native list and the items it already holds
+        void Initialize(hstring const& name, rive::ViewModelInstance* owner, rive::ViewModelInstanceList* nativeList,
+            std::vector<rive::rcp<rive::ViewModelInstanceListItem>> existingItems,
+            std::shared_ptr<RenderCommandQueue> commandQueue, std::shared_ptr<ViewModelInstanceRegistry> registry);
+#endif
+
+    private:
+        struct Entry
+        {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+            // Owned, so an item outside the window outlives its wrapper
+            rive::rcp<rive::ViewModelInstance> nativeInstance;
+#endif
+            winrt::WinRive::ViewModelInstance wrapper{ nullptr };   // Made on first GetAt for adopted items
+        };
+
+        hstring m_name;
+        std::vector<Entry> m_items;
+        int32_t m_windowStart{ 0 };
+        int32_t m_windowCount{ -1 };   // Negative: the whole list
+        std::shared_ptr<RenderCommandQueue> m_commandQueue;
+        std::shared_ptr<ViewModelInstanceRegistry> m_registry;   // Registers the wrappers GetAt makes
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        rive::ViewModelInstance* m_owner = nullptr;
+        rive::ViewModelInstanceList* m_nativeList = nullptr;
+        // Mirror of the native list as of the last posted edit
+        std::vector<rive::rcp<rive::ViewModelInstanceListItem>> m_nativeItems;
+        std::vector<rive::ViewModelInstance*> m_nativeInstances;
+#endif
+
+        bool TakeItems(array_view<winrt::WinRive::ViewModelInstance const> items, std::vector<Entry>& entries) const;
+        void Sync();
+    };
+}
+
+namespace winrt::WinRive::factory_implementation
+{
+    struct ViewModelList : ViewModelListT<ViewModelList, implementation::ViewModelList>
+    {
+    };
+}
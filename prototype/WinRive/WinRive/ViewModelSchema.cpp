@@ -0,0 +1,110 @@
+#include "pch.h"
+#include "ViewModelSchema.h"
+#include "../../shared/viewmodel_snapshot.h"
+
+namespace winrt::WinRive::implementation
+{
+    namespace
+    {
+        winrt::WinRive::ViewModelPropertyType MapPropertyKind(RiveRenderer::ViewModelPropertyKind kind)
+        {
+            using Kind = RiveRenderer::ViewModelPropertyKind;
+            switch (kind)
+            {
+            case Kind::String: return winrt::WinRive::ViewModelPropertyType::String;
+            case Kind::Number: return winrt::WinRive::ViewModelPropertyType::Number;
+            case Kind::Boolean: return winrt::WinRive::ViewModelPropertyType::Boolean;
+            case Kind::Color: return winrt::WinRive::ViewModelPropertyType::Color;
+            case Kind::Enum: return winrt::WinRive::ViewModelPropertyType::Enum;
+            case Kind::Trigger: return winrt::WinRive::ViewModelPropertyType::Trigger;
+            case Kind::List: return winrt::WinRive::ViewModelPropertyType::List;
+            case Kind::ViewModel: return winrt::WinRive::ViewModelPropertyType::ViewModel;
+            default: return winrt::WinRive::ViewModelPropertyType::Unknown;
+            }
+        }
+    }
+
+    std::shared_ptr<const ViewModelSchema> ViewModelSchema::Build(void* nativeViewModel)
+    {
+        auto schema = std::make_shared<ViewModelSchema>();
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        if (nativeViewModel)
+        {
+            auto* nativeVM = static_cast<rive::ViewModel*>(nativeViewModel);
+            const auto& properties = nativeVM->properties();
+            schema->m_properties.reserve(properties.size());
+
+            for (size_t i = 0; i < properties.size(); ++i)
+            {
+                auto property = properties[i];
+                if (!property)
+                {
+                    continue;
+                }
+
+                Property entry;
+                entry.name = winrt::to_hstring(property->name());
+                entry.nativeName = property->name();
+                entry.type = MapPropertyKind(RiveRenderer::GetViewModelPropertyKind(property));
+                entry.index = static_cast<int32_t>(i);
+                schema->m_properties.push_back(std::move(entry));
+            }
+        }
+#else
+        (void)nativeViewModel; // Unused parameter when Rive headers not available
+#endif
+
+        ViewModelFingerprint fingerprint;
+        for (const auto& property : schema->m_properties)
+        {
+            fingerprint.Add(property.nativeName, static_cast<uint8_t>(property.type));
+        }
+        schema->m_fingerprint = fingerprint.Value();
+
+        std::vector<winrt::WinRive::ViewModelPropertyInfo> infos;
+        infos.reserve(schema->m_properties.size());
+        schema->m_nameIndex.reserve(schema->m_properties.size());
+        for (size_t slot = 0; slot < schema->m_properties.size(); ++slot)
+        {
+            const auto& property = schema->m_properties[slot];
+            // First property wins on duplicate names, matching the old linear scan
+            schema->m_nameIndex.try_emplace(std::wstring_view(property.name), static_cast<int32_t>(slot));
+
+            winrt::WinRive::ViewModelPropertyInfo info{};
+            info.Name = property.name;
+            info.Type = property.type;
+            info.Index = property.index;
+            infos.push_back(info);
+        }
+        schema->m_infos = winrt::single_threaded_vector<winrt::WinRive::ViewModelPropertyInfo>(std::move(infos)).GetView();
+
+        return schema;
+    }
+
+    std::shared_ptr<const ViewModelSchema> ViewModelSchema::Empty()
+    {
+        static const auto empty = Build(nullptr);
+        return empty;
+    }
+
+    const ViewModelSchema::Property* ViewModelSchema::At(int32_t index) const
+    {
+        if (index < 0 || index >= Count())
+        {
+            return nullptr;
+        }
+        return &m_properties[index];
+    }
+
+    const ViewModelSchema::Property* ViewModelSchema::Find(hstring const& name) const
+    {
+        return At(IndexOf(name));
+    }
+
+    int32_t ViewModelSchema::IndexOf(hstring const& name) const
+    {
+        auto it = m_nameIndex.find(std::wstring_view(name));
+        return it != m_nameIndex.end() ? it->second : -1;
+    }
+}
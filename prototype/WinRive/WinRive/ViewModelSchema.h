@@ -0,0 +1,48 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace winrt::WinRive::implementation
+{
+    // Property layout of one rive::ViewModel - names, types and indices plus a
+    // name index. Immutable once built and shared by the ViewModel wrapper and
+    // every instance wrapper of that view model, so lookups are a hash probe
+    // and enumeration hands out the same collection every time.
+    class ViewModelSchema
+    {
+    public:
+        struct Property
+        {
+            hstring name;
+            std::string nativeName;
+            winrt::WinRive::ViewModelPropertyType type;
+            int32_t index;
+        };
+
+        // nativeViewModel is a rive::ViewModel*; null gives an empty schema
+        static std::shared_ptr<const ViewModelSchema> Build(void* nativeViewModel);
+        static std::shared_ptr<const ViewModelSchema> Empty();
+
+        int32_t Count() const { return static_cast<int32_t>(m_properties.size()); }
+        const Property* At(int32_t index) const;
+        const Property* Find(hstring const& name) const;
+        int32_t IndexOf(hstring const& name) const;   // -1 when not found
+
+        // Hash of the property names and types in slot order; two schemas
+        // with the same fingerprint lay out their values the same way
+        uint64_t Fingerprint() const { return m_fingerprint; }
+
+        Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelPropertyInfo> Infos() const { return m_infos; }
+
+    private:
+        std::vector<Property> m_properties;
+        uint64_t m_fingerprint = 0;
+        // Keys view the hstrings above, whose buffers never move
+        std::unordered_map<std::wstring_view, int32_t> m_nameIndex;
+        Windows::Foundation::Collections::IVectorView<winrt::WinRive::ViewModelPropertyInfo> m_infos{ nullptr };
+    };
+}
@@ -0,0 +1,52 @@
+#include "fixed_step_clock.h"
+
+#include <algorithm>
+#include <cmath>
+
+void FixedStepClock::Configure(float stepSeconds, int maxCatchUpSteps)
+{
+    m_stepSeconds = std::max(stepSeconds, 0.0f);
+    m_maxCatchUpSteps = std::max(maxCatchUpSteps, 1);
+    m_accumulator = 0.0;
+    m_hasLastFrame = false;
+}
+
+int FixedStepClock::Tick(TimePoint now, float timeScale)
+{
+    if (!IsEnabled()) {
+        return 0;
+    }
+
+    // A scale of 0 freezes the simulation but keeps the frame time moving, so
+    // nothing is owed on resume. Negative and non-finite scales count as 0
+    // rather than leaving a NaN in the accumulator for good.
+    if (!(timeScale > 0.0f) || !std::isfinite(timeScale)) {
+        timeScale = 0.0f;
+    }
+
+    // The scale stretches the time fed to the accumulator, not the step, so
+    // slow motion still advances in identical steps
+    if (m_hasLastFrame) {
+        m_accumulator += std::chrono::duration<double>(now - m_lastFrame).count() * timeScale;
+    } else {
+        // First frame after start, pause or a timing change: one step
+        m_accumulator += m_stepSeconds * timeScale;
+    }
+    m_lastFrame = now;
+    m_hasLastFrame = true;
+
+    // Every step is the same length, so the state after N steps doesn't
+    // depend on how they were spread across frames
+    int steps = 0;
+    while (m_accumulator >= m_stepSeconds && steps < m_maxCatchUpSteps) {
+        m_accumulator -= m_stepSeconds;
+        ++steps;
+    }
+
+    // Out of catch-up budget - drop whole steps we couldn't afford but keep
+    // the fraction so the cadence stays even
+    if (m_accumulator >= m_stepSeconds) {
+        m_accumulator = std::fmod(m_accumulator, static_cast<double>(m_stepSeconds));
+    }
+    return steps;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+// Clock behind RiveRenderer::SetFixedTimestep. Each frame's elapsed time,
+// stretched by the time scale, is turned into a whole number of equal steps;
+// the remainder carries over to the next frame. Render thread only.
+
+#include <chrono>
+
+class FixedStepClock {
+public:
+    using TimePoint = std::chrono::steady_clock::time_point;
+
+    // A step of 0 turns fixed stepping off. Starts over with nothing owed.
+    void Configure(float stepSeconds, int maxCatchUpSteps);
+
+    bool IsEnabled() const { return m_stepSeconds > 0.0f; }
+    float StepSeconds() const { return m_stepSeconds; }
+    // Scaled time owed to the simulation, always less than one step between
+    // frames
+    double Pending() const { return m_accumulator; }
+
+    // Forgets the last frame time, so time spent paused or skipped by a seek
+    // isn't owed to the simulation. The next Tick runs one step.
+    void Restart() { m_hasLastFrame = false; }
+
+    // Adds the time since the last Tick and returns how many steps to run
+    // now, at most the catch-up limit. Whole steps past the limit are
+    // dropped rather than carried into later frames.
+    int Tick(TimePoint now, float timeScale);
+
+private:
+    float m_stepSeconds = 0.0f;
+    int m_maxCatchUpSteps = 4;
+    double m_accumulator = 0.0;
+    TimePoint m_lastFrame;
+    bool m_hasLastFrame = false;
+};
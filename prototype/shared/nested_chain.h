@@ -0,0 +1,90 @@
+#pragma once
+
+// Staleness bookkeeping for the wrappers of nested view model instances.
+// The file can re-point a nested property at any time, and the host can
+// replace one, so a wrapper made for the instance a property held earlier
+// has to stop writing into it, and paths compiled through it have to
+// resolve again. Two pieces do that:
+//
+// NestingEpoch - one counter per wrapper tree, moved on every replacement.
+// Compiled paths remember the value they were resolved at.
+//
+// NestedChain - the levels a nested wrapper was reached by, checked on the
+// render thread before each of its writes. The first level found re-pointed
+// is flagged so the UI thread knows to wrap what the property holds now.
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Copies share the counter, so a bump made through any wrapper in the tree
+// is seen by all of them. UI thread only.
+class NestingEpoch {
+public:
+    uint32_t Value() const { return *m_value; }
+    bool IsCurrent(uint32_t seen) const { return seen == *m_value; }
+    void Advance() { ++*m_value; }
+
+private:
+    std::shared_ptr<uint32_t> m_value = std::make_shared<uint32_t>(0);
+};
+
+// Root first. A Link is whatever one level needs to tell whether the parent
+// still holds the instance the wrapper below it was made for, via
+// `bool IsCurrent() const` on the render thread. Copies - the chains
+// captured by posted writes, and those of wrappers further down - share the
+// flags of the levels they have in common.
+template <typename Link>
+class NestedChain {
+public:
+    bool Empty() const { return m_levels.empty(); }
+
+    // The chain of a wrapper one level further down
+    NestedChain Extend(Link link) const
+    {
+        NestedChain chain = *this;
+        chain.m_levels.push_back({ std::move(link), std::make_shared<std::atomic<bool>>(false) });
+        return chain;
+    }
+
+    // Render thread. Whether a write through the chain may be applied: false
+    // once any level has been found re-pointed, flagging the first such
+    // level. A flagged level stays detached even if the property later
+    // points back, since the UI thread may already have replaced the wrapper.
+    bool Current() const
+    {
+        for (const auto& level : m_levels) {
+            if (level.detached->load(std::memory_order_relaxed)) {
+                return false;
+            }
+            if (!level.link.IsCurrent()) {
+                level.detached->store(true, std::memory_order_relaxed);
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Whether a write found the last level re-pointed, or with anyLevel
+    // whether it found any level re-pointed
+    bool IsDetached(bool anyLevel) const
+    {
+        if (m_levels.empty()) {
+            return false;
+        }
+        if (!anyLevel) {
+            return m_levels.back().detached->load(std::memory_order_relaxed);
+        }
+        return std::any_of(m_levels.begin(), m_levels.end(),
+            [](const Level& level) { return level.detached->load(std::memory_order_relaxed); });
+    }
+
+private:
+    struct Level {
+        Link link;
+        std::shared_ptr<std::atomic<bool>> detached;
+    };
+    std::vector<Level> m_levels;
+};
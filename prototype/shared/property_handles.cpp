@@ -0,0 +1,45 @@
+#include "property_handles.h"
+
+#include <atomic>
+
+void PropertyHandles::NewGeneration()
+{
+    static std::atomic<uint32_t> generation{ 0 };
+    uint32_t next = ++generation;
+    // Generation 0 is skipped so a zeroed handle never validates
+    m_generation = next != 0 ? next : ++generation;
+}
+
+uint64_t PropertyHandles::ForSlot(int32_t slot) const
+{
+    if (slot < 0) {
+        return kInvalid;
+    }
+    return (static_cast<uint64_t>(m_generation) << 32) | static_cast<uint32_t>(slot + 1);
+}
+
+uint64_t PropertyHandles::ForPath(uint32_t index) const
+{
+    if (index >= kMaxPaths) {
+        return kInvalid;
+    }
+    return (static_cast<uint64_t>(m_generation) << 32) | kPathFlag | (index + 1);
+}
+
+int32_t PropertyHandles::SlotOf(uint64_t handle, size_t count) const
+{
+    if ((handle >> 32) != m_generation || IsPath(handle)) {
+        return -1;
+    }
+    int64_t slot = static_cast<int64_t>(handle & 0xFFFFFFFF) - 1;
+    return slot >= 0 && static_cast<size_t>(slot) < count ? static_cast<int32_t>(slot) : -1;
+}
+
+int32_t PropertyHandles::PathOf(uint64_t handle, size_t count) const
+{
+    if ((handle >> 32) != m_generation || !IsPath(handle)) {
+        return -1;
+    }
+    int64_t index = static_cast<int64_t>(handle & (kPathFlag - 1)) - 1;
+    return index >= 0 && static_cast<size_t>(index) < count ? static_cast<int32_t>(index) : -1;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+// Encoding of the 64-bit property handles a view model instance wrapper
+// hands out. The high half is the wrapper's generation, the low half either
+// a schema slot + 1 or, with kPathFlag set, a compiled path index + 1, so 0
+// is never a valid handle.
+//
+// Generations come from one process-wide counter, so NewGeneration() makes
+// every handle taken before it fail here and in every other wrapper. At 32
+// bits it would take billions of re-pointed instances to come back around.
+// Not synchronized - one wrapper, one thread.
+
+#include <cstddef>
+#include <cstdint>
+
+class PropertyHandles {
+public:
+    static constexpr uint64_t kInvalid = 0;
+    static constexpr uint32_t kPathFlag = 0x80000000;
+    // Compiled paths a wrapper can hand out handles for
+    static constexpr size_t kMaxPaths = kPathFlag - 1;
+
+    // Rejects every handle made before now
+    void NewGeneration();
+    uint32_t Generation() const { return m_generation; }
+
+    uint64_t ForSlot(int32_t slot) const;
+    uint64_t ForPath(uint32_t index) const;
+
+    static bool IsPath(uint64_t handle) { return (handle & kPathFlag) != 0; }
+
+    // The slot or path index a handle of this generation refers to, below
+    // `count`; -1 for any other handle, including one of the other kind
+    int32_t SlotOf(uint64_t handle, size_t count) const;
+    int32_t PathOf(uint64_t handle, size_t count) const;
+
+private:
+    uint32_t m_generation = 0;
+};
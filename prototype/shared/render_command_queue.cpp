@@ -0,0 +1,193 @@
+#include "render_command_queue.h"
+
+void RenderCommandCompletion::Complete(bool result)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_result = result;
+        m_complete = true;
+    }
+    m_completed.notify_all();
+}
+
+bool RenderCommandCompletion::IsComplete()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_complete;
+}
+
+bool RenderCommandCompletion::Wait()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_completed.wait(lock, [this] { return m_complete; });
+    return m_result;
+}
+
+bool RenderCommandCompletion::WaitFor(std::chrono::milliseconds timeout, bool* result)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_completed.wait_for(lock, timeout, [this] { return m_complete; })) {
+        return false;
+    }
+    if (result) {
+        *result = m_result;
+    }
+    return true;
+}
+
+RenderCommandQueue::RenderCommandQueue()
+    : m_head(&m_stub), m_tail(&m_stub)
+{
+}
+
+RenderCommandQueue::~RenderCommandQueue()
+{
+    Close();
+}
+
+void RenderCommandQueue::Post(std::function<void()> command)
+{
+    if (!command) {
+        return;
+    }
+
+    auto node = new Node();
+    node->command = [command = std::move(command)]() { command(); return true; };
+    if (!PushUnlessClosed(node)) {
+        delete node;
+        return;
+    }
+    DrainInlineIfIdle();
+}
+
+std::shared_ptr<RenderCommandCompletion> RenderCommandQueue::PostWithCompletion(Command command)
+{
+    auto completion = std::make_shared<RenderCommandCompletion>();
+    if (!command) {
+        completion->Complete(false);
+        return completion;
+    }
+
+    auto node = new Node();
+    node->command = std::move(command);
+    node->completion = completion;
+    if (!PushUnlessClosed(node)) {
+        delete node;
+        completion->Complete(false);
+        return completion;
+    }
+    DrainInlineIfIdle();
+    return completion;
+}
+
+size_t RenderCommandQueue::Drain()
+{
+    m_drainingThread = std::this_thread::get_id();
+
+    size_t count = 0;
+    while (Node* node = Pop()) {
+        bool result = node->command();
+        if (node->completion) {
+            node->completion->Complete(result);
+        }
+        delete node;
+        ++count;
+    }
+
+    m_drainingThread = std::thread::id();
+    return count;
+}
+
+bool RenderCommandQueue::IsEmpty() const
+{
+    return m_tail == &m_stub ? m_stub.next.load(std::memory_order_acquire) == nullptr : false;
+}
+
+void RenderCommandQueue::SetInlineDrain(std::function<void()> inlineDrain)
+{
+    std::lock_guard<std::mutex> lock(m_inlineMutex);
+    m_inlineDrain = std::move(inlineDrain);
+}
+
+void RenderCommandQueue::Close()
+{
+    std::lock_guard<std::mutex> lock(m_inlineMutex);
+    {
+        // Waits out producers between their closed check and their link
+        std::unique_lock<std::shared_mutex> closeLock(m_closeMutex);
+        m_closed = true;
+    }
+    m_inlineDrain = nullptr;
+
+    while (Node* node = Pop()) {
+        if (node->completion) {
+            node->completion->Complete(false);
+        }
+        delete node;
+    }
+}
+
+bool RenderCommandQueue::PushUnlessClosed(Node* node)
+{
+    std::shared_lock<std::shared_mutex> lock(m_closeMutex);
+    if (m_closed) {
+        return false;
+    }
+    Push(node);
+    return true;
+}
+
+void RenderCommandQueue::Push(Node* node)
+{
+    node->next.store(nullptr, std::memory_order_relaxed);
+    Node* previous = m_head.exchange(node, std::memory_order_acq_rel);
+    previous->next.store(node, std::memory_order_release);
+}
+
+RenderCommandQueue::Node* RenderCommandQueue::Pop()
+{
+    Node* tail = m_tail;
+    Node* next = tail->next.load(std::memory_order_acquire);
+
+    if (tail == &m_stub) {
+        if (!next) {
+            return nullptr;
+        }
+        m_tail = next;
+        tail = next;
+        next = next->next.load(std::memory_order_acquire);
+    }
+
+    if (next) {
+        m_tail = next;
+        return tail;
+    }
+
+    // tail is the last node unless a producer is between its exchange and its
+    // link; in that case leave it for the next drain
+    if (tail != m_head.load(std::memory_order_acquire)) {
+        return nullptr;
+    }
+
+    // Re-append the stub so tail can be handed out without emptying the list
+    Push(&m_stub);
+    next = tail->next.load(std::memory_order_acquire);
+    if (next) {
+        m_tail = next;
+        return tail;
+    }
+    return nullptr;
+}
+
+void RenderCommandQueue::DrainInlineIfIdle()
+{
+    // A command posting from inside a drain is picked up by that same drain
+    if (m_consumerRunning || m_drainingThread.load() == std::this_thread::get_id()) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(m_inlineMutex);
+    if (m_inlineDrain && !m_consumerRunning) {
+        m_inlineDrain();
+    }
+}
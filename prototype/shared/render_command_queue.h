@@ -0,0 +1,96 @@
+#pragma once
+
+// Scene mutations posted from any thread and run by the render thread at the
+// top of its next frame, so nothing but the render thread touches the scene
+// while it advances and draws.
+//
+// Producers don't wait on each other or the consumer: Post() is one
+// allocation and one atomic exchange (Vyukov's intrusive MPSC list) under a
+// shared lock that only Close() takes exclusively. The consumer side must be
+// serialized by the owner - RiveRenderer only drains with m_deviceMutex held.
+// While no render thread is consuming, Post() drains inline through the
+// owner's callback.
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+
+// Completion of one posted command. Resolves with the command's result, or
+// with false if the command was dropped because its queue closed first.
+class RenderCommandCompletion {
+public:
+    void Complete(bool result);
+    bool IsComplete();
+
+    // Block until the command ran; returns its result. Never call from the
+    // render thread.
+    bool Wait();
+    // As Wait() but gives up after timeout; returns false on timeout
+    bool WaitFor(std::chrono::milliseconds timeout, bool* result = nullptr);
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_completed;
+    bool m_complete = false;
+    bool m_result = false;
+};
+
+class RenderCommandQueue {
+public:
+    using Command = std::function<bool()>;
+
+    RenderCommandQueue();
+    ~RenderCommandQueue();
+    RenderCommandQueue(const RenderCommandQueue&) = delete;
+    RenderCommandQueue& operator=(const RenderCommandQueue&) = delete;
+
+    // Producer side - any thread, fire and forget
+    void Post(std::function<void()> command);
+    // Producer side with a completion to wait on
+    std::shared_ptr<RenderCommandCompletion> PostWithCompletion(Command command);
+
+    // Consumer side - the owner serializes these
+    size_t Drain();
+    bool IsEmpty() const;
+
+    // Whether a render thread drains every frame. When it doesn't, Post()
+    // calls inlineDrain so commands still run promptly.
+    void SetConsumerRunning(bool running) { m_consumerRunning = running; }
+    void SetInlineDrain(std::function<void()> inlineDrain);
+
+    // Detach from the owner: pending commands are dropped (their completions
+    // resolve false) and later posts are ignored
+    void Close();
+
+private:
+    struct Node {
+        std::atomic<Node*> next{ nullptr };
+        Command command;
+        std::shared_ptr<RenderCommandCompletion> completion;
+    };
+
+    void Push(Node* node);
+    bool PushUnlessClosed(Node* node);
+    Node* Pop();
+    void DrainInlineIfIdle();
+
+    std::atomic<Node*> m_head;   // Producers exchange here
+    Node* m_tail;                // Consumer only; starts at the stub
+    Node m_stub;
+
+    std::atomic<bool> m_consumerRunning{ false };
+    // Held shared from a producer's closed check through its link, so Close()
+    // never sees a half-linked node and nothing is pushed after it
+    std::shared_mutex m_closeMutex;
+    bool m_closed = false;
+    std::atomic<std::thread::id> m_drainingThread{};
+
+    std::mutex m_inlineMutex;
+    std::function<void()> m_inlineDrain;
+};
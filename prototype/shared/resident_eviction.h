@@ -0,0 +1,65 @@
+#pragma once
+
+// Which resident state machine instances RiveRenderer drops when the resident
+// set outgrows its byte budget (see ResidentStateMachine). Templated on the
+// slot so it builds without the Rive runtime: a slot needs nullable owning
+// `instance` and `resetSpare` pointers and a `lastUsed` stamp, and `bytesOf`
+// estimates one instance.
+
+#include <cstddef>
+#include <vector>
+
+template <typename Slot, typename BytesOf>
+size_t SumResidentBytes(const std::vector<Slot>& slots, BytesOf bytesOf)
+{
+    size_t bytes = 0;
+    for (const auto& slot : slots) {
+        if (slot.instance) {
+            bytes += bytesOf(slot.instance.get());
+        }
+        if (slot.resetSpare) {
+            bytes += bytesOf(slot.resetSpare.get());
+        }
+    }
+    return bytes;
+}
+
+// Drops reset spares, then the least recently used instances other than
+// `active`, until the set fits in `capacity`; `evicted` is called for each
+// slot that lost its instance. Returns the bytes still resident, which only
+// stay over capacity when the active instance doesn't fit on its own.
+template <typename Slot, typename BytesOf, typename Evicted>
+size_t EvictLeastRecentlyUsed(std::vector<Slot>& slots, const void* active, size_t capacity, BytesOf bytesOf,
+                              Evicted evicted)
+{
+    size_t residentBytes = SumResidentBytes(slots, bytesOf);
+
+    // Spares are only an optimization, so they go before any instance
+    for (auto& slot : slots) {
+        if (residentBytes <= capacity) {
+            break;
+        }
+        if (slot.resetSpare) {
+            residentBytes -= bytesOf(slot.resetSpare.get());
+            slot.resetSpare = nullptr;
+        }
+    }
+
+    // State machine counts are small, so a scan for the oldest beats keeping
+    // an ordered list up to date on every switch
+    while (residentBytes > capacity) {
+        Slot* oldest = nullptr;
+        for (auto& slot : slots) {
+            if (slot.instance && slot.instance.get() != active && (!oldest || slot.lastUsed < oldest->lastUsed)) {
+                oldest = &slot;
+            }
+        }
+        if (!oldest) {
+            break;
+        }
+        residentBytes -= bytesOf(oldest->instance.get());
+        oldest->instance = nullptr;
+        evicted(*oldest);
+    }
+    return residentBytes;
+}
@@ -0,0 +1,220 @@
+#include "riv_archive.h"
+
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+    // One mapping per archive path, shared by every control that opens it
+    std::mutex g_archiveMutex;
+    std::unordered_map<std::string, std::weak_ptr<RivArchive>> g_openArchives;
+
+    void SetError(std::string* error, const std::string& message)
+    {
+        if (error) {
+            *error = message;
+        }
+    }
+}
+
+std::shared_ptr<RivArchive> RivArchive::Open(const std::string& path, std::string* error)
+{
+    std::lock_guard<std::mutex> lock(g_archiveMutex);
+
+    auto it = g_openArchives.find(path);
+    if (it != g_openArchives.end()) {
+        if (auto archive = it->second.lock()) {
+            return archive;
+        }
+    }
+
+    std::shared_ptr<RivArchive> archive(new RivArchive());
+    if (!archive->Map(path, error) || !archive->Validate(error)) {
+        return nullptr;
+    }
+
+    g_openArchives[path] = archive;
+    return archive;
+}
+
+RivArchive::~RivArchive()
+{
+#if defined(_WIN32)
+    if (m_base) {
+        UnmapViewOfFile(m_base);
+    }
+    if (m_mappingHandle) {
+        CloseHandle(m_mappingHandle);
+    }
+    if (m_fileHandle && m_fileHandle != INVALID_HANDLE_VALUE) {
+        CloseHandle(m_fileHandle);
+    }
+#else
+    if (m_base) {
+        munmap(const_cast<uint8_t*>(m_base), m_size);
+    }
+#endif
+}
+
+bool RivArchive::Map(const std::string& path, std::string* error)
+{
+    m_path = path;
+
+#if defined(_WIN32)
+    int wideLength = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, nullptr, 0);
+    std::wstring widePath(wideLength > 0 ? wideLength - 1 : 0, L'\0');
+    if (wideLength > 1) {
+        MultiByteToWideChar(CP_UTF8, 0, path.c_str(), -1, widePath.data(), wideLength);
+    }
+
+    HANDLE file = CreateFileW(widePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+        OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        SetError(error, "Failed to open archive " + path);
+        return false;
+    }
+    m_fileHandle = file;
+
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart == 0) {
+        SetError(error, "Archive is empty: " + path);
+        return false;
+    }
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+
+    m_mappingHandle = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m_mappingHandle) {
+        SetError(error, "Failed to map archive " + path);
+        return false;
+    }
+
+    m_base = static_cast<const uint8_t*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        SetError(error, "Failed to open archive " + path);
+        return false;
+    }
+
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || info.st_size == 0) {
+        close(fd);
+        SetError(error, "Archive is empty: " + path);
+        return false;
+    }
+    m_size = static_cast<size_t>(info.st_size);
+
+    void* mapped = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd); // The mapping keeps the file referenced
+    m_base = mapped == MAP_FAILED ? nullptr : static_cast<const uint8_t*>(mapped);
+#endif
+
+    if (!m_base) {
+        SetError(error, "Failed to map archive " + path);
+        return false;
+    }
+    return true;
+}
+
+bool RivArchive::Validate(std::string* error)
+{
+    // Structures are read in place, which relies on a little-endian host -
+    // true for every Windows target and the Linux packing tool's hosts
+    if (m_size < sizeof(RivArchiveHeader)) {
+        SetError(error, "Archive is truncated: " + m_path);
+        return false;
+    }
+
+    m_header = reinterpret_cast<const RivArchiveHeader*>(m_base);
+    if (std::memcmp(m_header->magic, kRivArchiveMagic, sizeof(kRivArchiveMagic)) != 0 ||
+        m_header->version != kRivArchiveVersion) {
+        SetError(error, "Not a supported .rivpack archive: " + m_path);
+        return false;
+    }
+
+    // Offsets come from the file, so regions are checked by subtraction - a
+    // sum could wrap past the mapping size
+    const uint64_t size = m_size;
+    auto fits = [size](uint64_t offset, uint64_t count, uint64_t elementSize) {
+        return offset <= size && count <= (size - offset) / elementSize;
+    };
+    const bool bucketsValid = m_header->bucketCount != 0 &&
+        (m_header->bucketCount & (m_header->bucketCount - 1)) == 0 &&
+        m_header->bucketCount > m_header->entryCount;
+    if (!fits(m_header->tocOffset, m_header->entryCount, sizeof(RivArchiveEntry)) ||
+        !fits(m_header->bucketOffset, m_header->bucketCount, sizeof(uint32_t)) ||
+        !fits(m_header->namesOffset, m_header->namesSize, 1) || !bucketsValid) {
+        SetError(error, "Archive index is corrupt: " + m_path);
+        return false;
+    }
+
+    m_entries = reinterpret_cast<const RivArchiveEntry*>(m_base + m_header->tocOffset);
+    m_buckets = reinterpret_cast<const uint32_t*>(m_base + m_header->bucketOffset);
+    m_names = reinterpret_cast<const char*>(m_base + m_header->namesOffset);
+
+    // Check entry bounds once here so lookups can trust them
+    for (uint32_t i = 0; i < m_header->entryCount; ++i) {
+        const auto& entry = m_entries[i];
+        if (entry.nameOffset > m_header->namesSize || entry.nameLength > m_header->namesSize - entry.nameOffset ||
+            entry.dataOffset > m_size || entry.dataSize > m_size - entry.dataOffset) {
+            SetError(error, "Archive entry " + std::to_string(i) + " is out of bounds: " + m_path);
+            return false;
+        }
+    }
+    return true;
+}
+
+bool RivArchive::Find(std::string_view name, Entry& entry) const
+{
+    if (!m_header) {
+        return false;
+    }
+
+    const uint64_t hash = RivArchiveHashName(name);
+    const uint32_t mask = m_header->bucketCount - 1;
+    for (uint32_t probe = 0; probe < m_header->bucketCount; ++probe) {
+        const uint32_t slot = m_buckets[(hash + probe) & mask];
+        if (slot == 0) {
+            return false;
+        }
+
+        const uint32_t index = slot - 1;
+        if (index < m_header->entryCount) {
+            const auto& candidate = m_entries[index];
+            if (candidate.nameHash == hash &&
+                std::string_view(m_names + candidate.nameOffset, candidate.nameLength) == name) {
+                entry = GetEntryAt(index);
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+RivArchive::Entry RivArchive::GetEntryAt(size_t index) const
+{
+    Entry result;
+    if (m_header && index < m_header->entryCount) {
+        const auto& entry = m_entries[index];
+        result.name = std::string_view(m_names + entry.nameOffset, entry.nameLength);
+        result.data = m_base + entry.dataOffset;
+        result.size = static_cast<size_t>(entry.dataSize);
+        result.flags = entry.flags;
+    }
+    return result;
+}
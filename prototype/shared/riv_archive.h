@@ -0,0 +1,111 @@
+#pragma once
+
+// Indexed archive of .riv files and shared assets, memory-mapped once and
+// read in place. Layout (all integers little-endian):
+//
+//   RivArchiveHeader                       at offset 0
+//   RivArchiveEntry[entryCount]            at header.tocOffset
+//   uint32_t[bucketCount]                  at header.bucketOffset
+//   UTF-8 names, not terminated            at header.namesOffset
+//   entry payloads                         each at a multiple of header.alignment
+//
+// Lookup hashes the entry name (FNV-1a 64), masks it into the bucket table
+// and probes linearly; a bucket holds entry index + 1, or 0 when empty. The
+// table is kept at most half full so a lookup touches one or two buckets.
+//
+// Archives are written by the rivpack tool (prototype/tools/rivpack).
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+constexpr char kRivArchiveMagic[8] = { 'R', 'I', 'V', 'P', 'A', 'C', 'K', '1' };
+constexpr uint32_t kRivArchiveVersion = 1;
+
+enum RivArchiveEntryFlags : uint32_t {
+    RivArchiveEntryRive = 1u << 0,   // A .riv file that can be imported
+    RivArchiveEntryAsset = 1u << 1   // A shared asset (image, font, audio)
+};
+
+#pragma pack(push, 1)
+struct RivArchiveHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t bucketCount;      // Power of two
+    uint32_t alignment;        // Payload alignment in bytes
+    uint64_t tocOffset;
+    uint64_t bucketOffset;
+    uint64_t namesOffset;
+    uint64_t namesSize;
+    uint64_t reserved;
+};
+
+struct RivArchiveEntry {
+    uint64_t nameHash;
+    uint32_t nameOffset;       // Relative to header.namesOffset
+    uint32_t nameLength;
+    uint64_t dataOffset;
+    uint64_t dataSize;
+    uint32_t flags;            // RivArchiveEntryFlags
+    uint32_t reserved;
+};
+#pragma pack(pop)
+
+static_assert(sizeof(RivArchiveHeader) == 64, "RivArchiveHeader layout is part of the file format");
+static_assert(sizeof(RivArchiveEntry) == 40, "RivArchiveEntry layout is part of the file format");
+
+inline uint64_t RivArchiveHashName(std::string_view name)
+{
+    uint64_t hash = 14695981039346656037ull;
+    for (unsigned char c : name) {
+        hash ^= c;
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+// A mapped archive. Entry data points into the mapping and stays valid for the
+// archive's lifetime; Open() shares one mapping per path across callers.
+class RivArchive {
+public:
+    struct Entry {
+        std::string_view name;
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+        uint32_t flags = 0;
+    };
+
+    static std::shared_ptr<RivArchive> Open(const std::string& path, std::string* error = nullptr);
+
+    ~RivArchive();
+    RivArchive(const RivArchive&) = delete;
+    RivArchive& operator=(const RivArchive&) = delete;
+
+    bool Find(std::string_view name, Entry& entry) const;
+    size_t GetEntryCount() const { return m_header ? m_header->entryCount : 0; }
+    Entry GetEntryAt(size_t index) const;
+
+    const std::string& GetPath() const { return m_path; }
+    size_t GetMappedSize() const { return m_size; }
+
+private:
+    RivArchive() = default;
+    bool Map(const std::string& path, std::string* error);
+    bool Validate(std::string* error);
+
+    std::string m_path;
+    const uint8_t* m_base = nullptr;
+    size_t m_size = 0;
+    const RivArchiveHeader* m_header = nullptr;
+    const RivArchiveEntry* m_entries = nullptr;
+    const uint32_t* m_buckets = nullptr;
+    const char* m_names = nullptr;
+
+#if defined(_WIN32)
+    void* m_fileHandle = nullptr;
+    void* m_mappingHandle = nullptr;
+#endif
+};
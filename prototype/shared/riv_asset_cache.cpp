@@ -0,0 +1,186 @@
+#include "riv_asset_cache.h"
+#include "riv_loader.h"
+
+#include <algorithm>
+#include <iostream>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#endif
+
+RiveAssetCache& RiveAssetCache::Instance()
+{
+    // Leaked on purpose - see the header
+    static RiveAssetCache* instance = new RiveAssetCache();
+    return *instance;
+}
+
+void RiveAssetCache::Prefetch(const std::vector<std::string>& paths)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (const auto& path : paths) {
+        if (path.empty() || m_cacheIndex.count(path) || m_queued.count(path) || m_inFlight.count(path)) {
+            continue;
+        }
+        m_queue.push_back(path);
+        m_queued.insert(path);
+        ++m_statistics.requested;
+    }
+    StartWorkersLocked();
+}
+
+void RiveAssetCache::CancelPrefetch()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_statistics.cancelled += m_queue.size() + m_inFlight.size();
+    m_queue.clear();
+    m_queued.clear();
+    ++m_generation;
+}
+
+std::shared_ptr<const std::vector<uint8_t>> RiveAssetCache::Get(const std::string& path)
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // A read that's already under way beats starting a second one
+    m_workFinished.wait(lock, [&] { return !m_inFlight.count(path); });
+
+    auto it = m_cacheIndex.find(path);
+    if (it == m_cacheIndex.end()) {
+        // Still queued - the caller reads it now, so don't read it twice
+        if (m_queued.erase(path)) {
+            m_queue.erase(std::find(m_queue.begin(), m_queue.end(), path));
+            ++m_statistics.cancelled;
+        }
+        ++m_statistics.misses;
+        return nullptr;
+    }
+
+    // Most recently used moves to the front, last in line for eviction
+    m_cache.splice(m_cache.begin(), m_cache, it->second);
+    ++m_statistics.hits;
+    return m_cache.front().second;
+}
+
+bool RiveAssetCache::Holds(const std::string& path, const std::vector<uint8_t>* bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_cacheIndex.find(path);
+    return it != m_cacheIndex.end() && it->second->second.get() == bytes;
+}
+
+void RiveAssetCache::SetMaxConcurrency(size_t workers)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_maxConcurrency = std::max<size_t>(workers, 1);
+    StartWorkersLocked();
+}
+
+void RiveAssetCache::SetCapacity(size_t bytes)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_capacity = bytes;
+    EvictLocked();
+}
+
+void RiveAssetCache::Clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_cache.clear();
+    m_cacheIndex.clear();
+    m_cachedBytes = 0;
+}
+
+void RiveAssetCache::Shutdown()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_statistics.cancelled += m_queue.size() + m_inFlight.size();
+    m_queue.clear();
+    m_queued.clear();
+    ++m_generation;
+
+    // In-flight reads finish and are discarded; the workers then find the
+    // queue empty and exit
+    m_workFinished.wait(lock, [this] { return m_workerCount == 0; });
+}
+
+RiveAssetCache::Statistics RiveAssetCache::GetStatistics()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Statistics statistics = m_statistics;
+    statistics.cachedBytes = m_cachedBytes;
+    statistics.cachedFiles = m_cache.size();
+    statistics.pending = m_queue.size() + m_inFlight.size();
+    return statistics;
+}
+
+void RiveAssetCache::StartWorkersLocked()
+{
+    // One worker per queued or in-flight file, up to the limit. Workers are
+    // detached - the instance outlives them - and counted for Shutdown()
+    while (m_workerCount < m_maxConcurrency && m_workerCount < m_queue.size() + m_inFlight.size()) {
+        std::thread(&RiveAssetCache::WorkerLoop, this).detach();
+        ++m_workerCount;
+    }
+}
+
+void RiveAssetCache::EvictLocked()
+{
+    while (m_cachedBytes > m_capacity && !m_cache.empty()) {
+        auto& oldest = m_cache.back();
+        m_cachedBytes -= oldest.second->size();
+        m_cacheIndex.erase(oldest.first);
+        m_cache.pop_back();
+    }
+}
+
+void RiveAssetCache::WorkerLoop()
+{
+#if defined(_WIN32)
+    // Background mode lowers both CPU and I/O priority so prefetching never
+    // competes with the render threads or a foreground load
+    SetThreadPriority(GetCurrentThread(), THREAD_MODE_BACKGROUND_BEGIN);
+#endif
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    // Exit instead of parking once there is nothing to do, or when a lowered
+    // limit leaves this worker surplus
+    while (!m_queue.empty() && m_inFlight.size() < m_maxConcurrency) {
+        std::string path = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_queued.erase(path);
+        m_inFlight.insert(path);
+        const uint64_t generation = m_generation;
+
+        lock.unlock();
+        std::string error;
+        auto data = RiveSourceLoader::ReadFile(path, &error);
+        lock.lock();
+
+        m_inFlight.erase(path);
+        if (generation != m_generation) {
+            // Cancelled while reading - already counted by CancelPrefetch
+        } else if (!data) {
+            ++m_statistics.failed;
+            std::cout << "Prefetch failed: " << error << std::endl;
+        } else if (data->size() <= m_capacity) {
+            m_cache.emplace_front(path, std::move(data));
+            m_cacheIndex[path] = m_cache.begin();
+            m_cachedBytes += m_cache.front().second->size();
+            ++m_statistics.completed;
+            EvictLocked();
+        }
+
+        m_workFinished.notify_all();
+    }
+
+    --m_workerCount;
+    m_workFinished.notify_all();
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+// Process-wide cache of .riv source bytes that navigation code can warm ahead
+// of time. Prefetch() queues paths for a small pool of low-priority workers
+// that read (and decompress) them through RiveSourceLoader; a later
+// RiveRenderer::LoadRiveFile shares the bytes from here instead of reading
+// the disk.
+//
+// Workers only exist while there is work and exit once the queue drains. The
+// instance is never destroyed, so no thread is joined during static
+// destruction (under the loader lock when this lives in a DLL); hosts that
+// unload the DLL call Shutdown() first.
+//
+// Only source bytes are cached. A parsed rive::File is tied to the render
+// context of the renderer that imported it, so parsing stays per control.
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+class RiveAssetCache {
+public:
+    struct Statistics {
+        uint64_t requested = 0;   // Paths accepted by Prefetch
+        uint64_t completed = 0;   // Prefetches that landed in the cache
+        uint64_t failed = 0;      // Prefetches that could not be read
+        uint64_t cancelled = 0;   // Prefetches dropped by CancelPrefetch
+        uint64_t hits = 0;        // Get() served from the cache or an in-flight read
+        uint64_t misses = 0;      // Get() that fell back to a direct read
+        size_t cachedBytes = 0;
+        size_t cachedFiles = 0;
+        size_t pending = 0;       // Queued or in flight
+    };
+
+    static RiveAssetCache& Instance();
+
+    RiveAssetCache(const RiveAssetCache&) = delete;
+    RiveAssetCache& operator=(const RiveAssetCache&) = delete;
+
+    // Queue paths for background reading. Paths already cached, queued or in
+    // flight are skipped.
+    void Prefetch(const std::vector<std::string>& paths);
+
+    // Drop everything still queued. Reads already in flight finish but their
+    // results are discarded.
+    void CancelPrefetch();
+
+    // A file's cached bytes, shared with the cache - it stays cached for the
+    // next control that loads it. Waits when the file is being read right now;
+    // returns nullptr (a miss) when it isn't cached yet, taking it off the
+    // queue since the caller is about to read it anyway.
+    std::shared_ptr<const std::vector<uint8_t>> Get(const std::string& path);
+
+    // Whether the cache's entry for path is this buffer - the cache then
+    // holds one of its references
+    bool Holds(const std::string& path, const std::vector<uint8_t>* bytes);
+
+    void SetMaxConcurrency(size_t workers);
+    void SetCapacity(size_t bytes);   // Least recently used files are evicted first
+    void Clear();
+
+    // Cancel all prefetching and wait for the workers to exit. A later
+    // Prefetch starts new ones.
+    void Shutdown();
+
+    Statistics GetStatistics();
+
+private:
+    using CacheList = std::list<std::pair<std::string, std::shared_ptr<const std::vector<uint8_t>>>>;
+
+    RiveAssetCache() = default;
+    void WorkerLoop();
+    void StartWorkersLocked();
+    void EvictLocked();
+
+    static constexpr size_t kDefaultMaxConcurrency = 2;
+    static constexpr size_t kDefaultCapacity = 64 * 1024 * 1024;
+
+    std::mutex m_mutex;
+    std::condition_variable m_workFinished;
+    size_t m_workerCount = 0;    // Detached workers still running
+
+    std::deque<std::string> m_queue;
+    std::unordered_set<std::string> m_queued;
+    std::unordered_set<std::string> m_inFlight;
+    uint64_t m_generation = 0;   // Bumped by CancelPrefetch to orphan in-flight reads
+
+    CacheList m_cache;           // Front is the most recent
+    std::unordered_map<std::string, CacheList::iterator> m_cacheIndex;
+    size_t m_cachedBytes = 0;
+
+    size_t m_maxConcurrency = kDefaultMaxConcurrency;
+    size_t m_capacity = kDefaultCapacity;
+    Statistics m_statistics;
+};
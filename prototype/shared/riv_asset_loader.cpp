@@ -0,0 +1,82 @@
+#include "riv_asset_loader.h"
+
+#include <iostream>
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+void RiveFileAssetLoader::SetArchive(std::shared_ptr<RivArchive> archive, std::string_view entryName)
+{
+    m_archive = std::move(archive);
+    auto slash = entryName.rfind('/');
+    m_entryDirectory = slash == std::string_view::npos ? std::string() : std::string(entryName.substr(0, slash + 1));
+}
+
+bool RiveFileAssetLoader::FindArchiveAsset(const rive::FileAsset& asset, RivArchive::Entry& entry) const
+{
+    if (!m_archive) {
+        return false;
+    }
+
+    const std::string names[] = { asset.uniqueFilename(), asset.name() };
+    for (const auto& name : names) {
+        if (name.empty()) {
+            continue;
+        }
+        if (!m_entryDirectory.empty() && m_archive->Find(m_entryDirectory + name, entry) &&
+            (entry.flags & RivArchiveEntryAsset)) {
+            return true;
+        }
+        if (m_archive->Find(name, entry) && (entry.flags & RivArchiveEntryAsset)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool RiveFileAssetLoader::loadContents(rive::FileAsset& asset, rive::Span<const uint8_t> inBandBytes, rive::Factory* factory)
+{
+    // Embedded bytes win; referenced assets come from the archive if any
+    const uint8_t* data = inBandBytes.data();
+    size_t size = inBandBytes.size();
+    bool fromArchive = false;
+    if (size == 0) {
+        RivArchive::Entry entry;
+        if (!FindArchiveAsset(asset, entry)) {
+            return false; // Left unresolved, as without a loader
+        }
+        data = entry.data;
+        size = entry.size;
+        fromArchive = true;
+    }
+
+    if (m_deferImageDecode && asset.is<rive::ImageAsset>()) {
+        // The asset is owned by the file being imported, which outlives this list
+        m_deferredImages.push_back({ &asset, rive::SimpleArray<uint8_t>(data, size) });
+        return true;
+    }
+
+    if (!fromArchive) {
+        return false; // Let the runtime decode in-band bytes as usual
+    }
+
+    rive::SimpleArray<uint8_t> bytes(data, size);
+    if (!asset.decode(bytes, factory)) {
+        std::cout << "Failed to decode archive asset " << asset.uniqueFilename() << "\n";
+        return false;
+    }
+    return true;
+}
+
+size_t RiveFileAssetLoader::DecodeDeferredImages(rive::Factory* factory)
+{
+    size_t decoded = 0;
+    for (auto& image : m_deferredImages) {
+        if (image.asset->decode(image.bytes, factory)) {
+            ++decoded;
+        } else {
+            std::cout << "Failed to decode image asset " << image.asset->name() << "\n";
+        }
+    }
+    m_deferredImages.clear();
+    return decoded;
+}
+#endif
@@ -0,0 +1,54 @@
+#pragma once
+
+// rive::FileAssetLoader used for every import.
+//
+// Referenced (out-of-band) assets are resolved from a .rivpack archive when
+// the file came from one: the asset's unique filename and then its name are
+// looked up next to the .riv entry, then at the archive root.
+//
+// With image deferral on, image bytes are kept instead of decoded so an import
+// can run off the render thread; DecodeDeferredImages() then creates the
+// textures on the thread that owns the render context's device context.
+
+#include "riv_archive.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+#include "rive/file_asset_loader.hpp"
+#include "rive/assets/file_asset.hpp"
+#include "rive/assets/image_asset.hpp"
+#include "rive/simple_array.hpp"
+
+class RiveFileAssetLoader : public rive::FileAssetLoader {
+public:
+    explicit RiveFileAssetLoader(bool deferImageDecode) : m_deferImageDecode(deferImageDecode) {}
+
+    // Resolve referenced assets from archive, relative to the .riv entry named
+    // entryName. The archive is kept alive with the loader.
+    void SetArchive(std::shared_ptr<RivArchive> archive, std::string_view entryName);
+
+    bool loadContents(rive::FileAsset& asset, rive::Span<const uint8_t> inBandBytes, rive::Factory* factory) override;
+
+    // Decodes the images held back during import. Returns how many decoded.
+    size_t DecodeDeferredImages(rive::Factory* factory);
+    size_t DeferredImageCount() const { return m_deferredImages.size(); }
+
+private:
+    bool FindArchiveAsset(const rive::FileAsset& asset, RivArchive::Entry& entry) const;
+
+    struct DeferredImage {
+        rive::FileAsset* asset;
+        rive::SimpleArray<uint8_t> bytes;
+    };
+
+    bool m_deferImageDecode;
+    std::shared_ptr<RivArchive> m_archive;
+    std::string m_entryDirectory;   // With a trailing '/', or empty at the root
+    std::vector<DeferredImage> m_deferredImages;
+};
+#endif
@@ -0,0 +1,318 @@
+#include "riv_loader.h"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <limits>
+
+#if defined(WINRIVE_WITH_ZLIB)
+#include <zlib.h>
+#endif
+
+namespace {
+    // Decompressed size hints come from the payload itself, so don't let a
+    // corrupt header trigger a huge up-front allocation
+    constexpr size_t kMaxSizeHint = size_t(1) << 30;
+    constexpr size_t kMinOutputSize = 64 * 1024;
+    // Output is grown by at most this much at a time, so only bytes about to
+    // be decoded into get zero-filled
+    constexpr size_t kOutputStep = 1024 * 1024;
+    // Largest span fed to a decoder in one call (zlib counts in 32 bits)
+    constexpr size_t kMaxInputSpan = size_t(1) << 30;
+
+    void SetError(std::string* error, const std::string& message)
+    {
+        if (error) {
+            *error = message;
+        }
+    }
+
+    uint32_t ReadLE32(const uint8_t* data)
+    {
+        return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+            (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+    }
+
+    // Feeds compressed input to a decoder - from a file one chunk at a time,
+    // starting with the prefix already read for format detection, or from memory
+    class InputSource {
+    public:
+        InputSource(const uint8_t* data, size_t size)
+            : m_data(data), m_size(size)
+        {
+        }
+
+        InputSource(std::ifstream* stream, std::vector<uint8_t>&& prefix, size_t chunkSize)
+            : m_stream(stream), m_staging(std::move(prefix)), m_chunkSize(chunkSize), m_prefixPending(true)
+        {
+        }
+
+        // Next span of input; false once the input is exhausted
+        bool Next(const uint8_t*& data, size_t& size)
+        {
+            if (!m_stream) {
+                size = std::min(m_size - m_offset, kMaxInputSpan);
+                data = m_data + m_offset;
+                m_offset += size;
+                return size > 0;
+            }
+
+            if (m_prefixPending) {
+                m_prefixPending = false;
+            } else {
+                m_staging.resize(m_chunkSize);
+                m_stream->read(reinterpret_cast<char*>(m_staging.data()), static_cast<std::streamsize>(m_staging.size()));
+                m_staging.resize(static_cast<size_t>(m_stream->gcount()));
+            }
+            data = m_staging.data();
+            size = m_staging.size();
+            return size > 0;
+        }
+
+    private:
+        const uint8_t* m_data = nullptr;
+        size_t m_size = 0;
+        size_t m_offset = 0;
+
+        std::ifstream* m_stream = nullptr;
+        std::vector<uint8_t> m_staging;
+        size_t m_chunkSize = 0;
+        bool m_prefixPending = false;
+    };
+
+    // Destination of a decoder - writes land directly in the caller's vector,
+    // whose capacity is reserved from the payload's own size hint when it has
+    // one. The size only moves ahead of the decoder a step at a time.
+    class OutputBuffer {
+    public:
+        OutputBuffer(std::vector<uint8_t>& out, uint64_t sizeHint)
+            : m_out(out)
+        {
+            size_t initial = static_cast<size_t>(std::min<uint64_t>(sizeHint, kMaxSizeHint));
+            m_out.clear();
+            m_out.reserve(std::max(initial, kMinOutputSize));
+        }
+
+        // Writable space at the end of the output, growing it when full
+        uint8_t* Tail(size_t& available)
+        {
+            if (m_used == m_out.size()) {
+                // Stay inside the reservation while there is room, so a correct
+                // size hint never reallocates; past it the vector grows geometrically
+                size_t step = std::max(std::min(m_out.size() / 2, kOutputStep), kMinOutputSize);
+                if (m_out.capacity() > m_out.size()) {
+                    step = std::min(step, m_out.capacity() - m_out.size());
+                }
+                m_out.resize(m_out.size() + step);
+            }
+            available = m_out.size() - m_used;
+            return m_out.data() + m_used;
+        }
+
+        bool Full() const { return m_used == m_out.size(); }
+        void Commit(size_t bytes) { m_used += bytes; }
+
+        void Finish()
+        {
+            m_out.resize(m_used);
+            // Only pay for a compacting copy when the size hint was well off
+            if (m_out.capacity() > m_used + m_used / 8) {
+                m_out.shrink_to_fit();
+            }
+        }
+
+    private:
+        std::vector<uint8_t>& m_out;
+        size_t m_used = 0;
+    };
+
+    uint64_t SizeHint(RiveSourceLoader::Encoding encoding, const uint8_t* trailer)
+    {
+        switch (encoding) {
+        case RiveSourceLoader::Encoding::Gzip:
+            // ISIZE - uncompressed size modulo 2^32 in the last four bytes
+            return trailer ? ReadLE32(trailer) : 0;
+        default:
+            return 0;
+        }
+    }
+
+#if defined(WINRIVE_WITH_ZLIB)
+    bool InflateGzip(InputSource& input, OutputBuffer& output, std::string* error)
+    {
+        z_stream stream{};
+        if (inflateInit2(&stream, 15 + 16) != Z_OK) { // 16: expect a gzip wrapper
+            SetError(error, "Failed to initialize zlib");
+            return false;
+        }
+
+        int status = Z_OK;
+        const uint8_t* chunk = nullptr;
+        size_t chunkSize = 0;
+        while (status != Z_STREAM_END && input.Next(chunk, chunkSize)) {
+            stream.next_in = const_cast<Bytef*>(chunk);
+            stream.avail_in = static_cast<uInt>(chunkSize);
+
+            // Keep going while there is input, or output space ran out and
+            // zlib may still hold decoded bytes
+            while (status != Z_STREAM_END && (stream.avail_in > 0 || output.Full())) {
+                size_t available = 0;
+                uint8_t* tail = output.Tail(available);
+                uInt limit = static_cast<uInt>(std::min<size_t>(available, std::numeric_limits<uInt>::max()));
+                stream.next_out = tail;
+                stream.avail_out = limit;
+
+                status = inflate(&stream, Z_NO_FLUSH);
+                output.Commit(limit - stream.avail_out);
+
+                if (status == Z_BUF_ERROR && stream.avail_in == 0) {
+                    status = Z_OK; // Needs the next chunk
+                    break;
+                }
+                if (status != Z_OK && status != Z_STREAM_END) {
+                    SetError(error, std::string("gzip stream is corrupt: ") + (stream.msg ? stream.msg : "unknown error"));
+                    inflateEnd(&stream);
+                    return false;
+                }
+            }
+        }
+
+        inflateEnd(&stream);
+        if (status != Z_STREAM_END) {
+            SetError(error, "gzip stream is truncated");
+            return false;
+        }
+        return true;
+    }
+#endif
+
+    bool Decode(RiveSourceLoader::Encoding encoding, InputSource& input, OutputBuffer& output, std::string* error)
+    {
+        switch (encoding) {
+#if defined(WINRIVE_WITH_ZLIB)
+        case RiveSourceLoader::Encoding::Gzip:
+            return InflateGzip(input, output, error);
+#endif
+        default:
+            (void)input; // Unused parameters when no codec handles the encoding
+            (void)output;
+            SetError(error, std::string(RiveSourceLoader::EncodingName(encoding)) + " payloads are not supported by this build");
+            return false;
+        }
+    }
+}
+
+RiveSourceLoader::Encoding RiveSourceLoader::DetectEncoding(const uint8_t* data, size_t size)
+{
+    if (!data || size < 4) {
+        return Encoding::Unknown;
+    }
+    if (std::memcmp(data, "RIVE", 4) == 0) {
+        return Encoding::Raw;
+    }
+    if (data[0] == 0x1F && data[1] == 0x8B) {
+        return Encoding::Gzip;
+    }
+    return Encoding::Unknown;
+}
+
+const char* RiveSourceLoader::EncodingName(Encoding encoding)
+{
+    switch (encoding) {
+    case Encoding::Raw: return "riv";
+    case Encoding::Gzip: return "gzip";
+    default: return "unknown";
+    }
+}
+
+bool RiveSourceLoader::IsEncodingSupported(Encoding encoding)
+{
+    switch (encoding) {
+    case Encoding::Raw:
+        return true;
+#if defined(WINRIVE_WITH_ZLIB)
+    case Encoding::Gzip:
+        return true;
+#endif
+    default:
+        return false;
+    }
+}
+
+std::shared_ptr<const std::vector<uint8_t>> RiveSourceLoader::ReadFile(const std::string& path, std::string* error)
+{
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream.is_open()) {
+        SetError(error, "Failed to open " + path);
+        return nullptr;
+    }
+
+    const auto fileSize = static_cast<size_t>(stream.tellg());
+    stream.seekg(0);
+
+    // The first chunk doubles as the detection header and the first decoder input
+    std::vector<uint8_t> prefix(std::min(fileSize, kReadChunkSize));
+    stream.read(reinterpret_cast<char*>(prefix.data()), static_cast<std::streamsize>(prefix.size()));
+    if (static_cast<size_t>(stream.gcount()) != prefix.size()) {
+        SetError(error, "Failed to read " + path);
+        return nullptr;
+    }
+
+    auto bytes = std::make_shared<std::vector<uint8_t>>();
+    const Encoding encoding = DetectEncoding(prefix.data(), prefix.size());
+
+    if (encoding == Encoding::Raw || encoding == Encoding::Unknown) {
+        // Uncompressed - read the remainder straight into a buffer of the final size.
+        // Unknown payloads are passed through and left for rive::File::import to reject.
+        bytes->resize(fileSize);
+        if (!prefix.empty()) {
+            std::memcpy(bytes->data(), prefix.data(), prefix.size());
+        }
+        if (fileSize > prefix.size()) {
+            stream.read(reinterpret_cast<char*>(bytes->data() + prefix.size()),
+                static_cast<std::streamsize>(fileSize - prefix.size()));
+            if (static_cast<size_t>(stream.gcount()) != fileSize - prefix.size()) {
+                SetError(error, "Failed to read " + path);
+                return nullptr;
+            }
+        }
+        return bytes;
+    }
+
+    uint8_t trailer[4] = {};
+    bool hasTrailer = false;
+    if (encoding == Encoding::Gzip && fileSize >= 4) {
+        stream.seekg(static_cast<std::streamoff>(fileSize - 4));
+        stream.read(reinterpret_cast<char*>(trailer), 4);
+        hasTrailer = stream.gcount() == 4;
+        stream.clear();
+        stream.seekg(static_cast<std::streamoff>(prefix.size()));
+    }
+
+    const uint64_t sizeHint = SizeHint(encoding, hasTrailer ? trailer : nullptr);
+    OutputBuffer output(*bytes, sizeHint);
+    InputSource input(&stream, std::move(prefix), kReadChunkSize);
+    if (!Decode(encoding, input, output, error)) {
+        return nullptr;
+    }
+    output.Finish();
+    return bytes;
+}
+
+bool RiveSourceLoader::Decompress(const uint8_t* data, size_t size, std::vector<uint8_t>& out, std::string* error)
+{
+    const Encoding encoding = DetectEncoding(data, size);
+    if (encoding == Encoding::Raw || encoding == Encoding::Unknown) {
+        out.assign(data, data + size);
+        return true;
+    }
+
+    const uint64_t sizeHint = SizeHint(encoding, size >= 4 ? data + size - 4 : nullptr);
+    OutputBuffer output(out, sizeHint);
+    InputSource input(data, size);
+    if (!Decode(encoding, input, output, error)) {
+        return false;
+    }
+    output.Finish();
+    return true;
+}
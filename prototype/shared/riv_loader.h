@@ -0,0 +1,40 @@
+#pragma once
+
+// Reads .riv source bytes for RiveRenderer. Gzip-compressed payloads are
+// recognized by their magic bytes and inflated while they stream in from
+// disk, straight into the buffer that is handed to rive::File::import - only
+// a small read chunk is ever staged.
+//
+// Gzip support needs WINRIVE_WITH_ZLIB and zlib's headers. The projects
+// define it when WinRiveZlibIncludePath points at the zlib that ships with
+// the Rive runtime. Uncompressed .riv files are always supported.
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class RiveSourceLoader {
+public:
+    enum class Encoding {
+        Raw,    // Plain .riv ("RIVE" header)
+        Gzip,
+        Unknown
+    };
+
+    // Identify a payload from its first bytes (at least 4 are needed)
+    static Encoding DetectEncoding(const uint8_t* data, size_t size);
+    static const char* EncodingName(Encoding encoding);
+    static bool IsEncodingSupported(Encoding encoding);
+
+    // Read a file, decompressing it if needed. Returns nullptr on failure with
+    // the reason in error when provided.
+    static std::shared_ptr<const std::vector<uint8_t>> ReadFile(const std::string& path, std::string* error = nullptr);
+
+    // Decompress an in-memory payload into out
+    static bool Decompress(const uint8_t* data, size_t size, std::vector<uint8_t>& out, std::string* error = nullptr);
+
+private:
+    static constexpr size_t kReadChunkSize = 64 * 1024;
+};
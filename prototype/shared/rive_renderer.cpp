@@ -1,11 +1,74 @@
 #include "rive_renderer.h"
+#include "resident_eviction.h"
+
+#include <algorithm>
+#include <cmath>
 
 #ifndef M_PI
 #define M_PI 3.14159265358979323846
 #endif
 
+namespace {
+    // Source buffers published under SourceDataPolicy::Share, keyed by path.
+    // Entries are weak so the buffer goes away with the last renderer using it.
+    std::mutex g_sharedSourceMutex;
+    std::unordered_map<std::string, std::weak_ptr<const std::vector<uint8_t>>> g_sharedSources;
+
+    // Rough per-object costs used by GetMemoryUsage() - the runtime does not
+    // report its allocation sizes
+    constexpr size_t kEstimatedBytesPerCoreObject = 96;
+    constexpr size_t kEstimatedBytesPerInput = 48;
+    constexpr size_t kEstimatedBytesPerViewModelValue = 64;
+    constexpr size_t kSwapChainBufferCount = 2;
+    constexpr size_t kEstimatedRiveTargetPlanes = 3; // coverage, clip and scratch color
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    size_t EstimateStateMachineBytes(const rive::StateMachineInstance* stateMachine)
+    {
+        return sizeof(rive::StateMachineInstance) +
+            stateMachine->inputCount() * kEstimatedBytesPerInput +
+            stateMachine->stateMachine()->layerCount() * kEstimatedBytesPerCoreObject;
+    }
+#endif
+
+    std::shared_ptr<const std::vector<uint8_t>> FindSharedSource(const std::string& path)
+    {
+        std::lock_guard<std::mutex> lock(g_sharedSourceMutex);
+        auto it = g_sharedSources.find(path);
+        return it != g_sharedSources.end() ? it->second.lock() : nullptr;
+    }
+
+    void PublishSharedSource(const std::string& path, const std::shared_ptr<const std::vector<uint8_t>>& data)
+    {
+        std::lock_guard<std::mutex> lock(g_sharedSourceMutex);
+        for (auto it = g_sharedSources.begin(); it != g_sharedSources.end();) {
+            it = it->second.expired() ? g_sharedSources.erase(it) : std::next(it);
+        }
+        g_sharedSources[path] = data;
+    }
+
+    // Reads a .riv file, inflating gzip payloads as they stream in
+    std::shared_ptr<const std::vector<uint8_t>> ReadRiveFileBytes(const std::string& path)
+    {
+        std::string error;
+        auto bytes = RiveSourceLoader::ReadFile(path, &error);
+        if (!bytes) {
+            std::cout << error << std::endl;
+        }
+        return bytes;
+    }
+}
+
 RiveRenderer::RiveRenderer()
+    : m_commandQueue(std::make_shared<RenderCommandQueue>()),
+      m_viewModelInstanceRegistry(std::make_shared<ViewModelInstanceRegistry>())
 {
+    // Without a render thread, posted commands run on the posting thread
+    m_commandQueue->SetInlineDrain([this]() {
+        std::lock_guard<std::mutex> lock(m_deviceMutex);
+        m_commandQueue->Drain();
+    });
+
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
     // Initialize transform matrix to identity
     m_artboardTransform = rive::Mat2D();
@@ -16,7 +79,10 @@ RiveRenderer::RiveRenderer()
 
 RiveRenderer::~RiveRenderer()
 {
+    EnableHotReload(false);
     StopRenderThread();
+    // Wrappers may still hold the queue; detach it from this renderer
+    m_commandQueue->Close();
     CleanupRenderingResources();
     CleanupDeviceResources();
 }
@@ -87,6 +153,7 @@ RiveRenderer::ViewModelInfo RiveRenderer::GetDefaultViewModel()
             defaultInfo.name = viewModel->name();
             defaultInfo.index = 0;
             defaultInfo.id = 0; // Use 0 as ID since ViewModel doesn't have id() method
+            defaultInfo.nativeViewModel = viewModel;
         }
     }
 #endif
@@ -116,9 +183,9 @@ void* RiveRenderer::CreateViewModelInstance()
             : m_riveFile->createViewModelInstance(viewModelId, 0);
         
         if (instance) {
-            // Store the instance for lifetime management
-            m_viewModelInstances.push_back(instance);
-            return instance.get();
+            // The registry holds it for the caller (see GetViewModelInstanceRegistry)
+            void* created = instance.get();
+            return m_viewModelInstanceRegistry->Add(std::move(instance)) != ViewModelInstanceRegistry::kInvalidHandle ? created : nullptr;
         }
     }
 #endif
@@ -131,9 +198,8 @@ void* RiveRenderer::CreateViewModelInstanceById(int viewModelId)
     if (m_riveFile) {
         auto instance = m_riveFile->createViewModelInstance(viewModelId, 0);
         if (instance) {
-            // Store the instance for lifetime management
-            m_viewModelInstances.push_back(instance);
-            return instance.get();
+            void* created = instance.get();
+            return m_viewModelInstanceRegistry->Add(std::move(instance)) != ViewModelInstanceRegistry::kInvalidHandle ? created : nullptr;
         }
     }
 #endif
@@ -156,20 +222,28 @@ bool RiveRenderer::BindViewModelInstance(void* instance)
         return false;
     }
     
-    // Use shared_ptr from our stored instances
-    for (auto& storedInstance : m_viewModelInstances) {
-        if (storedInstance.get() == instance) {
-            // Bind to artboard using shared_ptr
-            m_artboard->bindViewModelInstance(storedInstance);
-            
-            // Bind to scene using shared_ptr
-            m_scene->bindViewModelInstance(storedInstance);
-            
-            // Update our current bound instance
-            m_viewModelInstance = storedInstance;
-            
-            return true;
+    // Registered instances, or the one already bound (the file's default
+    // instance has no host reference)
+    auto storedInstance = m_viewModelInstanceRegistry->Find(instance);
+    if (!storedInstance && m_viewModelInstance.get() == instance) {
+        storedInstance = m_viewModelInstance;
+    }
+    if (storedInstance) {
+        // Bind to artboard using shared_ptr
+        m_artboard->bindViewModelInstance(storedInstance);
+        
+        // Bind to scene using shared_ptr. Other resident state machines
+        // pick it up when they're next activated.
+        m_scene->bindViewModelInstance(storedInstance);
+        if (m_activeStateMachineIndex >= 0) {
+            m_stateMachines[m_activeStateMachineIndex].boundViewModel = storedInstance.get();
         }
+        
+        // Update our current bound instance; the binding keeps it alive
+        // after the host lets go
+        m_viewModelInstance = storedInstance;
+        
+        return true;
     }
 #endif
     (void)instance; // Unused parameter when Rive headers not available
@@ -185,22 +259,30 @@ void* RiveRenderer::GetBoundViewModelInstance()
 #endif
 }
 
-// Property access on bound instance - using existing test pattern
-bool RiveRenderer::SetViewModelStringProperty(const std::string& propertyName, const std::string& value)
-{
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+// Property access on bound instance. The type comes from the schema rather
+// than from casting the value and hoping
+rive::ViewModelInstanceValue* RiveRenderer::BoundPropertyOfKind(const std::string& propertyName, ViewModelPropertyKind kind)
+{
     if (!m_viewModelInstance) {
-        return false;
+        return nullptr;
     }
-    
-    // Use the existing test pattern: m_viewModelInstance->propertyValue("MyName")
+
     auto property = m_viewModelInstance->propertyValue(propertyName);
-    if (property) {
-        auto stringProperty = static_cast<rive::ViewModelInstanceString*>(property);
-        if (stringProperty) {
-            stringProperty->propertyValue(value);
-            return true;
-        }
+    if (!property || GetViewModelPropertyKind(property->viewModelProperty()) != kind) {
+        return nullptr;
+    }
+    return property;
+}
+#endif
+
+bool RiveRenderer::SetViewModelStringProperty(const std::string& propertyName, const std::string& value)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    auto stringProperty = static_cast<rive::ViewModelInstanceString*>(BoundPropertyOfKind(propertyName, ViewModelPropertyKind::String));
+    if (stringProperty) {
+        stringProperty->propertyValue(value);
+        return true;
     }
 #endif
     (void)propertyName; (void)value; // Unused parameters when Rive headers not available
@@ -210,17 +292,10 @@ bool RiveRenderer::SetViewModelStringProperty(const std::string& propertyName, c
 bool RiveRenderer::SetViewModelNumberProperty(const std::string& propertyName, double value)
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (!m_viewModelInstance) {
-        return false;
-    }
-    
-    auto property = m_viewModelInstance->propertyValue(propertyName);
-    if (property) {
-        auto numberProperty = static_cast<rive::ViewModelInstanceNumber*>(property);
-        if (numberProperty) {
-            numberProperty->propertyValue(static_cast<float>(value));
-            return true;
-        }
+    auto numberProperty = static_cast<rive::ViewModelInstanceNumber*>(BoundPropertyOfKind(propertyName, ViewModelPropertyKind::Number));
+    if (numberProperty) {
+        numberProperty->propertyValue(static_cast<float>(value));
+        return true;
     }
 #endif
     (void)propertyName; (void)value; // Unused parameters when Rive headers not available
@@ -230,17 +305,10 @@ bool RiveRenderer::SetViewModelNumberProperty(const std::string& propertyName, d
 bool RiveRenderer::SetViewModelBooleanProperty(const std::string& propertyName, bool value)
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (!m_viewModelInstance) {
-        return false;
-    }
-    
-    auto property = m_viewModelInstance->propertyValue(propertyName);
-    if (property) {
-        auto boolProperty = static_cast<rive::ViewModelInstanceBoolean*>(property);
-        if (boolProperty) {
-            boolProperty->propertyValue(value);
-            return true;
-        }
+    auto boolProperty = static_cast<rive::ViewModelInstanceBoolean*>(BoundPropertyOfKind(propertyName, ViewModelPropertyKind::Boolean));
+    if (boolProperty) {
+        boolProperty->propertyValue(value);
+        return true;
     }
 #endif
     (void)propertyName; (void)value; // Unused parameters when Rive headers not available
@@ -250,17 +318,10 @@ bool RiveRenderer::SetViewModelBooleanProperty(const std::string& propertyName,
 bool RiveRenderer::SetViewModelColorProperty(const std::string& propertyName, uint32_t color)
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (!m_viewModelInstance) {
-        return false;
-    }
-    
-    auto property = m_viewModelInstance->propertyValue(propertyName);
-    if (property) {
-        auto colorProperty = static_cast<rive::ViewModelInstanceColor*>(property);
-        if (colorProperty) {
-            colorProperty->propertyValue(color);
-            return true;
-        }
+    auto colorProperty = static_cast<rive::ViewModelInstanceColor*>(BoundPropertyOfKind(propertyName, ViewModelPropertyKind::Color));
+    if (colorProperty) {
+        colorProperty->propertyValue(color);
+        return true;
     }
 #endif
     (void)propertyName; (void)color; // Unused parameters when Rive headers not available
@@ -270,17 +331,10 @@ bool RiveRenderer::SetViewModelColorProperty(const std::string& propertyName, ui
 bool RiveRenderer::SetViewModelEnumProperty(const std::string& propertyName, int value)
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (!m_viewModelInstance) {
-        return false;
-    }
-    
-    auto property = m_viewModelInstance->propertyValue(propertyName);
-    if (property) {
-        auto enumProperty = static_cast<rive::ViewModelInstanceEnum*>(property);
-        if (enumProperty) {
-            enumProperty->propertyValue(static_cast<uint32_t>(value));
-            return true;
-        }
+    auto enumProperty = static_cast<rive::ViewModelInstanceEnum*>(BoundPropertyOfKind(propertyName, ViewModelPropertyKind::Enum));
+    if (enumProperty) {
+        enumProperty->propertyValue(static_cast<uint32_t>(value));
+        return true;
     }
 #endif
     (void)propertyName; (void)value; // Unused parameters when Rive headers not available
@@ -290,24 +344,78 @@ bool RiveRenderer::SetViewModelEnumProperty(const std::string& propertyName, int
 bool RiveRenderer::FireViewModelTrigger(const std::string& triggerName)
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (!m_viewModelInstance) {
-        return false;
-    }
-    
-    auto property = m_viewModelInstance->propertyValue(triggerName);
-    if (property) {
-        auto trigger = static_cast<rive::ViewModelInstanceTrigger*>(property);
-        if (trigger) {
-            trigger->trigger();
-            return true;
-        }
+    auto trigger = static_cast<rive::ViewModelInstanceTrigger*>(BoundPropertyOfKind(triggerName, ViewModelPropertyKind::Trigger));
+    if (trigger) {
+        trigger->trigger();
+        return true;
     }
 #endif
     (void)triggerName; // Unused parameter when Rive headers not available
     return false;
 }
 
-// Property enumeration and access - using real ViewModel APIs
+RiveRenderer::ViewModelPropertyKind RiveRenderer::GetViewModelPropertyKind(const void* property)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (!property) {
+        return ViewModelPropertyKind::Unknown;
+    }
+
+    auto viewModelProperty = static_cast<const rive::ViewModelProperty*>(property);
+    const uint16_t coreType = viewModelProperty->coreType();
+
+    static std::mutex kindMutex;
+    static std::unordered_map<uint16_t, ViewModelPropertyKind> kindByCoreType;
+    std::lock_guard<std::mutex> lock(kindMutex);
+    auto it = kindByCoreType.find(coreType);
+    if (it != kindByCoreType.end()) {
+        return it->second;
+    }
+
+    // First time this key is seen - walk the type hierarchy once, so
+    // subclasses with keys of their own land on their base kind
+    ViewModelPropertyKind kind = ViewModelPropertyKind::Unknown;
+    if (viewModelProperty->is<rive::ViewModelPropertyString>()) {
+        kind = ViewModelPropertyKind::String;
+    } else if (viewModelProperty->is<rive::ViewModelPropertyNumber>()) {
+        kind = ViewModelPropertyKind::Number;
+    } else if (viewModelProperty->is<rive::ViewModelPropertyBoolean>()) {
+        kind = ViewModelPropertyKind::Boolean;
+    } else if (viewModelProperty->is<rive::ViewModelPropertyColor>()) {
+        kind = ViewModelPropertyKind::Color;
+    } else if (viewModelProperty->is<rive::ViewModelPropertyEnum>()) {
+        kind = ViewModelPropertyKind::Enum;
+    } else if (viewModelProperty->is<rive::ViewModelPropertyTrigger>()) {
+        kind = ViewModelPropertyKind::Trigger;
+    } else if (viewModelProperty->is<rive::ViewModelPropertyList>()) {
+        kind = ViewModelPropertyKind::List;
+    } else if (viewModelProperty->is<rive::ViewModelPropertyViewModel>()) {
+        kind = ViewModelPropertyKind::ViewModel;
+    }
+    kindByCoreType.emplace(coreType, kind);
+    return kind;
+#else
+    (void)property; // Unused parameter when Rive headers not available
+    return ViewModelPropertyKind::Unknown;
+#endif
+}
+
+const char* RiveRenderer::GetViewModelPropertyKindName(ViewModelPropertyKind kind)
+{
+    switch (kind) {
+    case ViewModelPropertyKind::String: return "String";
+    case ViewModelPropertyKind::Number: return "Number";
+    case ViewModelPropertyKind::Boolean: return "Boolean";
+    case ViewModelPropertyKind::Color: return "Color";
+    case ViewModelPropertyKind::Enum: return "Enum";
+    case ViewModelPropertyKind::Trigger: return "Trigger";
+    case ViewModelPropertyKind::List: return "List";
+    case ViewModelPropertyKind::ViewModel: return "ViewModel";
+    default: return "Unknown";
+    }
+}
+
+// Property enumeration - one pass over the schema, no value lookups
 std::vector<RiveRenderer::ViewModelPropertyInfo> RiveRenderer::GetViewModelProperties(void* instance)
 {
     std::vector<ViewModelPropertyInfo> result;
@@ -318,57 +426,19 @@ std::vector<RiveRenderer::ViewModelPropertyInfo> RiveRenderer::GetViewModelPrope
     }
     
     auto riveInstance = static_cast<rive::ViewModelInstance*>(instance);
-    if (riveInstance && riveInstance->viewModel()) {
-        auto viewModel = riveInstance->viewModel();
-        auto properties = viewModel->properties();
+    if (riveInstance->viewModel()) {
+        const auto& properties = riveInstance->viewModel()->properties();
+        result.reserve(properties.size());
         
         for (size_t i = 0; i < properties.size(); ++i) {
             auto property = properties[i];
             if (property) {
                 ViewModelPropertyInfo info;
                 info.name = property->name();
+                info.kind = GetViewModelPropertyKind(property);
+                info.type = GetViewModelPropertyKindName(info.kind);
                 info.index = static_cast<int>(i);
-                
-                // Get the instance value to determine actual type using static_cast pattern
-                auto instanceValue = riveInstance->propertyValue(property->name());
-                if (instanceValue) {
-                    // Use static_cast and null check pattern like the test code
-                    auto stringProperty = static_cast<rive::ViewModelInstanceString*>(instanceValue);
-                    if (stringProperty) {
-                        info.type = "String";
-                    } else {
-                        auto numberProperty = static_cast<rive::ViewModelInstanceNumber*>(instanceValue);
-                        if (numberProperty) {
-                            info.type = "Number";
-                        } else {
-                            auto boolProperty = static_cast<rive::ViewModelInstanceBoolean*>(instanceValue);
-                            if (boolProperty) {
-                                info.type = "Boolean";
-                            } else {
-                                auto colorProperty = static_cast<rive::ViewModelInstanceColor*>(instanceValue);
-                                if (colorProperty) {
-                                    info.type = "Color";
-                                } else {
-                                    auto enumProperty = static_cast<rive::ViewModelInstanceEnum*>(instanceValue);
-                                    if (enumProperty) {
-                                        info.type = "Enum";
-                                    } else {
-                                        auto triggerProperty = static_cast<rive::ViewModelInstanceTrigger*>(instanceValue);
-                                        if (triggerProperty) {
-                                            info.type = "Trigger";
-                                        } else {
-                                            info.type = "Unknown";
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                    }
-                } else {
-                    info.type = "Unknown";
-                }
-                
-                result.push_back(info);
+                result.push_back(std::move(info));
             }
         }
     }
@@ -417,6 +487,7 @@ void* RiveRenderer::GetViewModelPropertyAt(void* instance, int index)
 
 void RiveRenderer::Shutdown()
 {
+    EnableHotReload(false);
     StopRenderThread();
     CleanupRenderingResources();
     CleanupDeviceResources();
@@ -455,21 +526,49 @@ void RiveRenderer::SetSize(int width, int height)
 bool RiveRenderer::LoadRiveFile(const std::string& filePath)
 {
     try {
-        std::ifstream file(filePath, std::ios::binary);
-        if (!file.is_open()) {
-            std::cout << "Failed to open Rive file: " << filePath << std::endl;
-            return false;
+        std::shared_ptr<const std::vector<uint8_t>> rivBytes;
+        if (m_sourceDataPolicy == SourceDataPolicy::Share) {
+            rivBytes = FindSharedSource(filePath);
         }
 
-        std::ifstream rivStream(filePath, std::ios::binary);
-        std::vector<uint8_t> rivBytes(std::istreambuf_iterator<char>(rivStream),
-            {});
-        m_riveFileData = rivBytes;
-        
-        m_riveFilePath = filePath;
-        
-        // Create Rive content
-        CreateRiveContent();
+        if (!rivBytes) {
+            // Prefetched bytes first, then the disk
+            rivBytes = RiveAssetCache::Instance().Get(filePath);
+            if (!rivBytes) {
+                rivBytes = ReadRiveFileBytes(filePath);
+            }
+            if (!rivBytes) {
+                std::cout << "Failed to open Rive file: " << filePath << std::endl;
+                return false;
+            }
+
+            if (m_sourceDataPolicy == SourceDataPolicy::Share) {
+                PublishSharedSource(filePath, rivBytes);
+            }
+        }
+
+        {
+            // Swap content under the device lock so the render thread never
+            // sees a half-built scene; commands posted for the old content
+            // run first
+            std::lock_guard<std::mutex> lock(m_deviceMutex);
+            m_commandQueue->Drain();
+
+            m_riveFileData = std::move(rivBytes);
+            m_riveFilePath = filePath;
+            m_riveArchive.reset();
+            m_riveArchiveEntry = {};
+            
+            // Create Rive content
+            CreateRiveContent(m_riveFileData->data(), m_riveFileData->size());
+            ApplySourceDataPolicy();
+        }
+
+        // Point an active watcher at the new file
+        if (m_hotReloadEnabled) {
+            EnableHotReload(false);
+            EnableHotReload(true);
+        }
         
         return true;
     }
@@ -479,162 +578,574 @@ bool RiveRenderer::LoadRiveFile(const std::string& filePath)
     }
 }
 
-void RiveRenderer::CreateCompositionSurface()
-{
-    if (!m_swapChain || !m_compositor) return;
-
-    // Create a sprite visual for the DirectX content
-    m_riveVisual = m_compositor.CreateSpriteVisual();
-    m_riveVisual.Size({ static_cast<float>(m_renderWidth), static_cast<float>(m_renderHeight) });
-    
-    // Use ICompositorInterop to create composition surface for swap chain
-    auto compositorInterop = m_compositor.as<ABI::Windows::UI::Composition::ICompositorInterop>();
-    
-    winrt::com_ptr<ABI::Windows::UI::Composition::ICompositionSurface> compositionSurface;
-    winrt::check_hresult(compositorInterop->CreateCompositionSurfaceForSwapChain(
-        m_swapChain.get(),
-        compositionSurface.put()
-    ));
-    
-    // Create surface brush from the composition surface
-    auto surface = compositionSurface.as<winrt::Windows::UI::Composition::ICompositionSurface>();
-    auto surfaceBrush = m_compositor.CreateSurfaceBrush(surface);
-    m_riveVisual.Brush(surfaceBrush);
-}
-
-void RiveRenderer::CreateDeviceResources()
+bool RiveRenderer::LoadRiveFileFromArchive(const std::string& archivePath, const std::string& entryName)
 {
-    // Create D3D11 device
-    D3D_FEATURE_LEVEL featureLevels[] = {
-        D3D_FEATURE_LEVEL_11_1,
-        D3D_FEATURE_LEVEL_11_0,
-        D3D_FEATURE_LEVEL_10_1,
-        D3D_FEATURE_LEVEL_10_0
-    };
-
-    winrt::com_ptr<::ID3D11Device> device;
-    winrt::com_ptr<::ID3D11DeviceContext> context;
-    
-    winrt::check_hresult(D3D11CreateDevice(
-        nullptr,
-        D3D_DRIVER_TYPE_HARDWARE,
-        nullptr,
-        D3D11_CREATE_DEVICE_BGRA_SUPPORT,
-        featureLevels,
-        ARRAYSIZE(featureLevels),
-        D3D11_SDK_VERSION,
-        device.put(),
-        nullptr,
-        context.put()
-    ));
+    try {
+        std::string error;
+        auto archive = RivArchive::Open(archivePath, &error);
+        if (!archive) {
+            std::cout << error << std::endl;
+            return false;
+        }
 
-    // Get D3D11.1 interfaces
-    winrt::check_hresult(device->QueryInterface(IID_PPV_ARGS(m_d3dDevice.put())));
-    winrt::check_hresult(context->QueryInterface(IID_PPV_ARGS(m_d3dContext.put())));
+        RivArchive::Entry entry;
+        if (!archive->Find(entryName, entry) || !(entry.flags & RivArchiveEntryRive)) {
+            std::cout << "No Rive entry '" << entryName << "' in " << archivePath << std::endl;
+            return false;
+        }
 
-    // Create DXGI factory
-    winrt::com_ptr<::IDXGIDevice1> dxgiDevice;
-    winrt::check_hresult(m_d3dDevice->QueryInterface(IID_PPV_ARGS(dxgiDevice.put())));
+        // Hot reload watches loose files only
+        EnableHotReload(false);
 
-    winrt::com_ptr<::IDXGIAdapter> adapter;
-    winrt::check_hresult(dxgiDevice->GetAdapter(adapter.put()));
+        auto encoding = RiveSourceLoader::DetectEncoding(entry.data, entry.size);
+        if (encoding == RiveSourceLoader::Encoding::Raw) {
+            std::lock_guard<std::mutex> lock(m_deviceMutex);
+            m_commandQueue->Drain();
+
+            // Import from the mapped pages; the archive is shared by every
+            // renderer that opens it, so nothing is copied per instance
+            m_riveFileData.reset();
+            m_riveArchive = std::move(archive);
+            m_riveArchiveEntry = entry;
+            m_riveFilePath.clear();
+            CreateRiveContent(entry.data, entry.size, m_riveArchive, entry.name);
+            return true;
+        }
 
-    winrt::check_hresult(adapter->GetParent(IID_PPV_ARGS(m_dxgiFactory.put())));
+        auto rivBytes = std::make_shared<std::vector<uint8_t>>();
+        if (!RiveSourceLoader::Decompress(entry.data, entry.size, *rivBytes, &error)) {
+            std::cout << error << std::endl;
+            return false;
+        }
 
-    // Create swap chain
-    CreateSwapChain();
-}
+        std::lock_guard<std::mutex> lock(m_deviceMutex);
+        m_commandQueue->Drain();
 
-void RiveRenderer::CreateSwapChain()
-{
-    DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
-    swapChainDesc.Width = m_renderWidth;
-    swapChainDesc.Height = m_renderHeight;
-    swapChainDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
-    swapChainDesc.Stereo = FALSE;
-    swapChainDesc.SampleDesc.Count = 1;
-    swapChainDesc.SampleDesc.Quality = 0;
-    swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT | DXGI_USAGE_UNORDERED_ACCESS;
-    swapChainDesc.BufferCount = 2;
-    swapChainDesc.Scaling = DXGI_SCALING_STRETCH;
-    swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
-    swapChainDesc.AlphaMode = DXGI_ALPHA_MODE_PREMULTIPLIED;
-    auto hr = m_dxgiFactory->CreateSwapChainForComposition(
-        m_d3dDevice.get(),
-        &swapChainDesc,
-        nullptr,
-        m_swapChain.put()
-    );
-    winrt::check_hresult(hr);
+        m_riveFileData = std::move(rivBytes);
+        m_riveArchive.reset();
+        m_riveArchiveEntry = {};
+        m_riveFilePath.clear();
+        // Referenced assets still come from the archive
+        CreateRiveContent(m_riveFileData->data(), m_riveFileData->size(), archive, entry.name);
+        ApplySourceDataPolicy();
+        return true;
+    }
+    catch (const std::exception& e) {
+        std::cout << "Error loading Rive archive entry: " << e.what() << std::endl;
+        return false;
+    }
 }
 
-void RiveRenderer::CreateRenderTarget()
+void RiveRenderer::SetSourceDataPolicy(SourceDataPolicy policy)
 {
-    // This will be implemented when Rive dependencies are properly configured
+    m_sourceDataPolicy = policy;
+    if (m_riveFileData && policy == SourceDataPolicy::Share) {
+        PublishSharedSource(m_riveFilePath, m_riveFileData);
+    }
+    ApplySourceDataPolicy();
 }
 
-void RiveRenderer::CreateRiveContext()
+void RiveRenderer::ApplySourceDataPolicy()
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    auto d3dContextOptions = rive::gpu::D3DContextOptions{};
-
-    m_riveGpu = m_d3dDevice.get();
-    m_riveGpuContext = m_d3dContext.get();
-    m_riveRenderContext = rive::gpu::RenderContextD3DImpl::MakeContext(m_riveGpu,
-        m_riveGpuContext,
-        d3dContextOptions);
-
-    if (m_riveRenderContext) {
-        auto renderContextImpl = m_riveRenderContext->static_impl_cast<rive::gpu::RenderContextD3DImpl>();
-        m_riveRenderTarget = renderContextImpl->makeRenderTarget(m_renderWidth, m_renderHeight);
-        m_riveRenderer = std::make_unique<rive::RiveRenderer>(m_riveRenderContext.get());
+    // rive::File copies what it needs during import, so once a file is live
+    // the source bytes are only kept if the policy asks for them
+    if (m_sourceDataPolicy == SourceDataPolicy::Release && m_riveFile) {
+        m_riveFileData.reset();
     }
 #endif
 }
 
-void RiveRenderer::CreateRiveContent()
+void RiveRenderer::EnableHotReload(bool enable)
 {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (!m_riveFileData.empty() && m_riveRenderContext) {
-        m_riveFile = rive::File::import(m_riveFileData, m_riveRenderContext.get());
-        if (m_riveFile) {
-            MakeScene();
-            // Enumerate and initialize state machines
-            EnumerateAndInitializeStateMachines();
+#if defined(WINRIVE_HOT_RELOAD_AVAILABLE)
+    if (m_hotReloadThread.joinable()) {
+        m_hotReloadEnabled = false;
+        m_hotReloadThread.join();
+    }
+
+    if (enable) {
+        if (m_riveFilePath.empty()) {
+            std::cout << "Hot reload needs a loaded Rive file\n";
+            return;
         }
+        m_hotReloadEnabled = true;
+        m_hotReloadThread = std::thread(&RiveRenderer::HotReloadLoop, this, m_riveFilePath);
+    }
+#else
+    if (enable) {
+        std::cout << "Hot reload is only available in development builds\n";
     }
 #endif
 }
 
-void RiveRenderer::ClearScene()
+void RiveRenderer::SetContentReloadedCallback(std::function<void()> callback)
 {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    m_artboard = nullptr;
-    m_scene = nullptr; 
-    m_viewModelInstance = nullptr;
-	m_activeStateMachine = nullptr;
-	m_stateMachineActive = false;
-	m_defaultStateMachineIndex = -1;
-	m_stateMachines.clear();
-#endif
+    m_contentReloadedCallback = std::move(callback);
 }
 
-void RiveRenderer::MakeScene()
+void RiveRenderer::HotReloadLoop(std::string filePath)
 {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    ClearScene();
-    
-    // Following path_fiddle make_scenes pattern - but using ArtboardInstance for API compatibility
-    auto rawArtboard = m_riveFile->artboardDefault();
-    auto artboard = rawArtboard->instance();
-    std::unique_ptr<rive::Scene> scene;
-    
-    // Try default state machine first, then animation, following path_fiddle priority
-    if (m_defaultStateMachineIndex >= 0) {
+    std::error_code ec;
+    auto lastWriteTime = std::filesystem::last_write_time(filePath, ec);
+    std::filesystem::file_time_type pendingWriteTime{};
+    bool changePending = false;
+
+    while (m_hotReloadEnabled) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(250));
+
+        auto writeTime = std::filesystem::last_write_time(filePath, ec);
+        if (ec || writeTime == lastWriteTime) {
+            changePending = false;
+            continue;
+        }
+
+        // Wait for one quiet poll so a save still in progress isn't picked up
+        if (!changePending || writeTime != pendingWriteTime) {
+            changePending = true;
+            pendingWriteTime = writeTime;
+            continue;
+        }
+        changePending = false;
+        lastWriteTime = writeTime;
+
+        auto data = ReadRiveFileBytes(filePath);
+        if (!data || data->empty()) {
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        ImportReloadedContent(filePath, std::move(data));
+        auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+        std::cout << "Hot reload imported " << filePath << " in " << elapsed.count() << " ms\n";
+    }
+}
+
+void RiveRenderer::ImportReloadedContent(const std::string& filePath, std::shared_ptr<const std::vector<uint8_t>> data)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    // Parse on the watcher thread. The render context is the factory and it
+    // isn't thread-safe - building paths and buffers can touch the immediate
+    // context - so the import holds the device lock like any other use of it,
+    // taken before the context lock as everywhere else. Image textures are
+    // left for the render thread (see RiveFileAssetLoader).
+    auto loader = rive::make_rcp<RiveFileAssetLoader>(true);
+    rive::rcp<rive::File> file;
+    uint32_t contextGeneration = 0;
+    {
+        std::lock_guard<std::mutex> lock(m_deviceMutex);
+        std::lock_guard<std::mutex> contextLock(m_renderContextMutex);
+        if (!m_riveRenderContext) {
+            return;
+        }
+        contextGeneration = m_renderContextGeneration;
+        file = rive::File::import(
+            rive::Span<const uint8_t>(data->data(), data->size()),
+            m_riveRenderContext.get(),
+            nullptr,
+            loader);
+    }
+
+    // A broken save leaves the current content running
+    if (!file) {
+        std::cout << "Hot reload import failed, keeping current content\n";
+        return;
+    }
+
+    // The swap touches the scene, so it runs on the render thread
+    PostCommand([this, filePath, file, loader, data, contextGeneration]() {
+        bool contextReplaced;
+        {
+            std::lock_guard<std::mutex> contextLock(m_renderContextMutex);
+            contextReplaced = contextGeneration != m_renderContextGeneration;
+        }
+        if (contextReplaced || m_riveArchive || filePath != m_riveFilePath) {
+            std::cout << "Hot reload of " << filePath << " dropped, content changed during import\n";
+            return;
+        }
+
+        loader->DecodeDeferredImages(m_riveRenderContext.get());
+        ReloadRiveContent(file, data);
+
+        if (m_contentReloadedCallback) {
+            m_contentReloadedCallback();
+        }
+    });
+#else
+    (void)filePath; // Unused parameters when Rive headers not available
+    (void)data;
+#endif
+}
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+void RiveRenderer::ReloadRiveContent(rive::rcp<rive::File> file, std::shared_ptr<const std::vector<uint8_t>> data)
+{
+    // Runs as a render command under the device lock. Capture the running
+    // session by name so it survives the swap
+    struct InputState {
+        std::string name;
+        uint16_t coreType;
+        bool booleanValue;
+        float numberValue;
+    };
+    struct PropertyState {
+        std::string name;
+        uint16_t coreType;
+        std::string stringValue;
+        float numberValue = 0.0f;
+        bool booleanValue = false;
+        uint32_t uintValue = 0;
+    };
+
+    std::string stateMachineName;
+    bool stateMachinePlaying = m_stateMachineActive;
+    std::vector<InputState> inputs;
+    std::vector<PropertyState> properties;
+
+    if (m_activeStateMachine && m_activeStateMachineIndex >= 0) {
+        stateMachineName = m_artboard->stateMachineNameAt(m_activeStateMachineIndex);
+        for (size_t i = 0; i < m_activeStateMachine->inputCount(); ++i) {
+            auto input = m_activeStateMachine->input(i);
+            if (!input) {
+                continue;
+            }
+
+            InputState state{ input->name(), input->inputCoreType(), false, 0.0f };
+            if (state.coreType == rive::StateMachineBool::typeKey) {
+                state.booleanValue = static_cast<rive::SMIBool*>(input)->value();
+            } else if (state.coreType == rive::StateMachineNumber::typeKey) {
+                state.numberValue = static_cast<rive::SMINumber*>(input)->value();
+            } else {
+                continue; // Triggers carry no state
+            }
+            inputs.push_back(std::move(state));
+        }
+    }
+
+    if (m_viewModelInstance) {
+        for (auto value : m_viewModelInstance->propertyValues()) {
+            if (!value || !value->viewModelProperty()) {
+                continue;
+            }
+
+            PropertyState state;
+            state.name = value->viewModelProperty()->name();
+            state.coreType = value->coreType();
+            if (value->is<rive::ViewModelInstanceString>()) {
+                state.stringValue = value->as<rive::ViewModelInstanceString>()->propertyValue();
+            } else if (value->is<rive::ViewModelInstanceNumber>()) {
+                state.numberValue = value->as<rive::ViewModelInstanceNumber>()->propertyValue();
+            } else if (value->is<rive::ViewModelInstanceBoolean>()) {
+                state.booleanValue = value->as<rive::ViewModelInstanceBoolean>()->propertyValue();
+            } else if (value->is<rive::ViewModelInstanceColor>()) {
+                state.uintValue = static_cast<uint32_t>(value->as<rive::ViewModelInstanceColor>()->propertyValue());
+            } else if (value->is<rive::ViewModelInstanceEnum>()) {
+                state.uintValue = value->as<rive::ViewModelInstanceEnum>()->propertyValue();
+            } else {
+                continue;
+            }
+            properties.push_back(std::move(state));
+        }
+    }
+
+    // Swap in the new file and rebuild the scene
+    m_riveFile = std::move(file);
+    m_riveFileData = std::move(data);
+    MakeScene();
+    EnumerateAndInitializeStateMachines();
+    m_transformValid = false;
+
+    // Reapply by name - anything renamed or retyped in the new file is skipped
+    if (!stateMachineName.empty()) {
+        SetActiveStateMachineByName(stateMachineName);
+    }
+    if (m_activeStateMachine) {
+        for (const auto& state : inputs) {
+            if (state.coreType == rive::StateMachineBool::typeKey) {
+                SetBooleanInput(state.name, state.booleanValue);
+            } else {
+                SetNumberInput(state.name, state.numberValue);
+            }
+        }
+        m_stateMachineActive = stateMachinePlaying;
+    }
+
+    if (m_viewModelInstance) {
+        for (const auto& state : properties) {
+            auto value = m_viewModelInstance->propertyValue(state.name);
+            if (!value || value->coreType() != state.coreType) {
+                continue;
+            }
+
+            if (value->is<rive::ViewModelInstanceString>()) {
+                value->as<rive::ViewModelInstanceString>()->propertyValue(state.stringValue);
+            } else if (value->is<rive::ViewModelInstanceNumber>()) {
+                value->as<rive::ViewModelInstanceNumber>()->propertyValue(state.numberValue);
+            } else if (value->is<rive::ViewModelInstanceBoolean>()) {
+                value->as<rive::ViewModelInstanceBoolean>()->propertyValue(state.booleanValue);
+            } else if (value->is<rive::ViewModelInstanceColor>()) {
+                value->as<rive::ViewModelInstanceColor>()->propertyValue(static_cast<int>(state.uintValue));
+            } else if (value->is<rive::ViewModelInstanceEnum>()) {
+                value->as<rive::ViewModelInstanceEnum>()->propertyValue(state.uintValue);
+            }
+        }
+    }
+
+    if (m_sourceDataPolicy == SourceDataPolicy::Share) {
+        PublishSharedSource(m_riveFilePath, m_riveFileData);
+    }
+    ApplySourceDataPolicy();
+}
+#endif
+
+RiveRenderer::MemoryUsage RiveRenderer::GetMemoryUsage()
+{
+    std::lock_guard<std::mutex> lock(m_deviceMutex);
+    MemoryUsage usage;
+
+    if (m_riveFileData) {
+        // Another renderer holding the same buffer makes it shared; the
+        // asset cache's own reference doesn't
+        long holders = m_riveFileData.use_count();
+        if (RiveAssetCache::Instance().Holds(m_riveFilePath, m_riveFileData.get())) {
+            --holders;
+        }
+        if (holders > 1) {
+            usage.sharedSourceBytes = m_riveFileData->capacity();
+        } else {
+            usage.sourceBytes = m_riveFileData->capacity();
+        }
+    }
+
+    if (m_riveArchive) {
+        // Mapped archive pages are file-backed and shared across processes
+        usage.sharedSourceBytes += m_riveArchiveEntry.size;
+    }
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (m_riveFile) {
+        usage.fileBytes = sizeof(rive::File);
+        for (size_t i = 0; i < m_riveFile->artboardCount(); ++i) {
+            if (auto artboard = m_riveFile->artboard(i)) {
+                usage.fileBytes += artboard->objects().size() * kEstimatedBytesPerCoreObject;
+            }
+        }
+    }
+
+    if (m_artboard) {
+        usage.artboardBytes = sizeof(rive::ArtboardInstance) +
+            m_artboard->objects().size() * kEstimatedBytesPerCoreObject;
+    }
+
+    usage.stateMachineBytes = ResidentStateMachineBytes();
+    if (m_ownedScene) {
+        usage.stateMachineBytes += sizeof(rive::LinearAnimationInstance);
+    }
+
+    auto instances = m_viewModelInstanceRegistry->Instances();
+    if (m_viewModelInstance && !m_viewModelInstanceRegistry->Find(m_viewModelInstance.get())) {
+        instances.push_back(m_viewModelInstance);
+    }
+    for (const auto& instance : instances) {
+        if (instance) {
+            usage.viewModelInstanceBytes += sizeof(rive::ViewModelInstance) +
+                instance->propertyValues().size() * kEstimatedBytesPerViewModelValue;
+        }
+    }
+
+    if (m_riveRenderTarget) {
+        usage.gpuBytes += static_cast<size_t>(m_renderWidth) * m_renderHeight * 4 * kEstimatedRiveTargetPlanes;
+    }
+#endif
+
+    if (m_swapChain) {
+        usage.gpuBytes += static_cast<size_t>(m_renderWidth) * m_renderHeight * 4 * kSwapChainBufferCount;
+    }
+
+    return usage;
+}
+
+void RiveRenderer::CreateCompositionSurface()
+{
+    if (!m_swapChain || !m_compositor) return;
+
+    // Create a sprite visual for the DirectX content
+    m_riveVisual = m_compositor.CreateSpriteVisual();
+    m_riveVisual.Size({ static_cast<float>(m_renderWidth), static_cast<float>(m_renderHeight) });
+    
+    // Use ICompositorInterop to create composition surface for swap chain
+    auto compositorInterop = m_compositor.as<ABI::Windows::UI::Composition::ICompositorInterop>();
+    
+    winrt::com_ptr<ABI::Windows::UI::Composition::ICompositionSurface> compositionSurface;
+    winrt::check_hresult(compositorInterop->CreateCompositionSurfaceForSwapChain(
+        m_swapChain.get(),
+        compositionSurface.put()
+    ));
+    
+    // Create surface brush from the composition surface
+    auto surface = compositionSurface.as<winrt::Windows::UI::Composition::ICompositionSurface>();
+    auto surfaceBrush = m_compositor.CreateSurfaceBrush(surface);
+    m_riveVisual.Brush(surfaceBrush);
+}
+
+void RiveRenderer::CreateDeviceResources()
+{
+    // Create D3D11 device
+    D3D_FEATURE_LEVEL featureLevels[] = {
+        D3D_FEATURE_LEVEL_11_1,
+        D3D_FEATURE_LEVEL_11_0,
+        D3D_FEATURE_LEVEL_10_1,
+        D3D_FEATURE_LEVEL_10_0
+    };
+
+    winrt::com_ptr<::ID3D11Device> device;
+    winrt::com_ptr<::ID3D11DeviceContext> context;
+    
+    winrt::check_hresult(D3D11CreateDevice(
+        nullptr,
+        D3D_DRIVER_TYPE_HARDWARE,
+        nullptr,
+        D3D11_CREATE_DEVICE_BGRA_SUPPORT,
+        featureLevels,
+        ARRAYSIZE(featureLevels),
+        D3D11_SDK_VERSION,
+        device.put(),
+        nullptr,
+        context.put()
+    ));
+
+    // Get D3D11.1 interfaces
+    winrt::check_hresult(device->QueryInterface(IID_PPV_ARGS(m_d3dDevice.put())));
+    winrt::check_hresult(context->QueryInterface(IID_PPV_ARGS(m_d3dContext.put())));
+
+    // Create DXGI factory
+    winrt::com_ptr<::IDXGIDevice1> dxgiDevice;
+    winrt::check_hresult(m_d3dDevice->QueryInterface(IID_PPV_ARGS(dxgiDevice.put())));
+
+    winrt::com_ptr<::IDXGIAdapter> adapter;
+    winrt::check_hresult(dxgiDevice->GetAdapter(adapter.put()));
+
+    winrt::check_hresult(adapter->GetParent(IID_PPV_ARGS(m_dxgiFactory.put())));
+
+    // Create swap chain
+    CreateSwapChain();
+}
+
+void RiveRenderer::CreateSwapChain()
+{
+    DXGI_SWAP_CHAIN_DESC1 swapChainDesc = {};
+    swapChainDesc.Width = m_renderWidth;
+    swapChainDesc.Height = m_renderHeight;
+    swapChainDesc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+    swapChainDesc.Stereo = FALSE;
+    swapChainDesc.SampleDesc.Count = 1;
+    swapChainDesc.SampleDesc.Quality = 0;
+    swapChainDesc.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT | DXGI_USAGE_UNORDERED_ACCESS;
+    swapChainDesc.BufferCount = 2;
+    swapChainDesc.Scaling = DXGI_SCALING_STRETCH;
+    swapChainDesc.SwapEffect = DXGI_SWAP_EFFECT_FLIP_SEQUENTIAL;
+    swapChainDesc.AlphaMode = DXGI_ALPHA_MODE_PREMULTIPLIED;
+    auto hr = m_dxgiFactory->CreateSwapChainForComposition(
+        m_d3dDevice.get(),
+        &swapChainDesc,
+        nullptr,
+        m_swapChain.put()
+    );
+    winrt::check_hresult(hr);
+}
+
+void RiveRenderer::CreateRenderTarget()
+{
+    // This will be implemented when Rive dependencies are properly configured
+}
+
+void RiveRenderer::CreateRiveContext()
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    auto d3dContextOptions = rive::gpu::D3DContextOptions{};
+
+    m_riveGpu = m_d3dDevice.get();
+    m_riveGpuContext = m_d3dContext.get();
+    {
+        // A hot reload may be importing with the old context on the watcher thread
+        std::lock_guard<std::mutex> contextLock(m_renderContextMutex);
+        m_riveRenderContext = rive::gpu::RenderContextD3DImpl::MakeContext(m_riveGpu,
+            m_riveGpuContext,
+            d3dContextOptions);
+        ++m_renderContextGeneration;
+    }
+
+    if (m_riveRenderContext) {
+        auto renderContextImpl = m_riveRenderContext->static_impl_cast<rive::gpu::RenderContextD3DImpl>();
+        m_riveRenderTarget = renderContextImpl->makeRenderTarget(m_renderWidth, m_renderHeight);
+        m_riveRenderer = std::make_unique<rive::RiveRenderer>(m_riveRenderContext.get());
+    }
+#endif
+}
+
+void RiveRenderer::CreateRiveContent(const uint8_t* data, size_t size, std::shared_ptr<RivArchive> assetArchive, std::string_view entryName)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (data && size > 0 && m_riveRenderContext) {
+        // Imported on the render context's thread, so images decode in place
+        auto loader = rive::make_rcp<RiveFileAssetLoader>(false);
+        if (assetArchive) {
+            loader->SetArchive(std::move(assetArchive), entryName);
+        }
+        m_riveFile = rive::File::import(
+            rive::Span<const uint8_t>(data, size),
+            m_riveRenderContext.get(),
+            nullptr,
+            loader);
+        if (m_riveFile) {
+            MakeScene();
+            // Enumerate and initialize state machines
+            EnumerateAndInitializeStateMachines();
+        }
+    }
+#else
+    (void)data; // Unused parameters when Rive headers not available
+    (void)size;
+    (void)assetArchive;
+    (void)entryName;
+#endif
+}
+
+void RiveRenderer::ClearScene()
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    // Scenes reference the artboard, so they go first
+    ClearResidentStateMachines();
+    m_scene = nullptr;
+    m_ownedScene = nullptr;
+    m_animationInstance = nullptr;
+    m_artboard = nullptr;
+    m_viewModelInstance = nullptr;
+    m_snapshotInstance = nullptr;
+	m_stateMachineActive = false;
+	m_defaultStateMachineIndex = -1;
+#endif
+}
+
+void RiveRenderer::MakeScene()
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    ClearScene();
+    
+    // Following path_fiddle make_scenes pattern - but using ArtboardInstance for API compatibility
+    auto rawArtboard = m_riveFile->artboardDefault();
+    auto artboard = rawArtboard->instance();
+    std::unique_ptr<rive::Scene> scene;
+    rive::LinearAnimationInstance* animationInstance = nullptr;
+    
+    // Try default state machine first, then animation, following path_fiddle priority
+    if (m_defaultStateMachineIndex >= 0) {
         scene = artboard->stateMachineAt(m_defaultStateMachineIndex);
     }
     else {
-        scene = artboard->animationAt(0);
+        auto animation = artboard->animationAt(0);
+        animationInstance = animation.get();
+        scene = std::move(animation);
     }
     
     if (scene == nullptr) {
@@ -656,7 +1167,9 @@ void RiveRenderer::MakeScene()
     
     // Store the artboard instance and scene
     m_artboard = std::move(artboard);
-    m_scene = std::move(scene);
+    m_ownedScene = std::move(scene);
+    m_animationInstance = animationInstance;
+    m_scene = m_ownedScene.get();
 #endif
 }
 
@@ -674,6 +1187,7 @@ void RiveRenderer::StartRenderThread()
 {
     m_shouldRender = true;
     m_isPaused = false;
+    m_commandQueue->SetConsumerRunning(true);
     m_renderThread = std::thread(&RiveRenderer::RenderLoop, this);
 }
 
@@ -683,39 +1197,93 @@ void RiveRenderer::StopRenderThread()
     if (m_renderThread.joinable()) {
         m_renderThread.join();
     }
+    m_commandQueue->SetConsumerRunning(false);
+
+    // Anything posted after the last frame runs now
+    std::lock_guard<std::mutex> lock(m_deviceMutex);
+    m_commandQueue->Drain();
+}
+
+void RiveRenderer::PostCommand(std::function<void()> command)
+{
+    m_commandQueue->Post(std::move(command));
+}
+
+void RiveRenderer::PostActivation(std::function<void()> activate)
+{
+    ++m_pendingActivations;
+    m_commandQueue->Post([this, activate = std::move(activate)]() {
+        activate();
+        --m_pendingActivations;
+    });
+}
+
+std::shared_ptr<RenderCommandCompletion> RiveRenderer::PostCommandWithCompletion(std::function<bool()> command)
+{
+    return m_commandQueue->PostWithCompletion(std::move(command));
+}
+
+void RiveRenderer::RunSynchronized(const std::function<void()>& action)
+{
+    std::lock_guard<std::mutex> lock(m_deviceMutex);
+    m_commandQueue->Drain();
+    action();
 }
 
 void RiveRenderer::RenderLoop()
 {
     while (m_shouldRender) {
-        if (!m_isPaused && !m_deviceLost) {
+        {
             std::lock_guard<std::mutex> lock(m_deviceMutex);
-            
-            if (CheckDeviceLost()) {
-                HandleDeviceLost();
-                continue;
-            }
-            
-            // Only process input if we have valid Rive content and rendering context
+
+            // Posted scene mutations run first - even while paused - so this
+            // frame's advance sees each of them whole
+            m_commandQueue->Drain();
+
+            if (!m_isPaused && !m_deviceLost) {
+                if (CheckDeviceLost()) {
+                    HandleDeviceLost();
+                    continue;
+                }
+                
+                // Only process input if we have valid Rive content and rendering context
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-            if (m_riveRenderContext && m_scene && m_artboard) {
-                ProcessInputQueue();
-            } else {
-                // Clear input queue if not ready to process
+                if (m_riveRenderContext && m_scene && m_artboard) {
+                    // Change feed baseline: the host writes drained above are
+                    // folded in, so listeners fired by pointer input are
+                    // reported along with the advance
+                    if (m_viewModelChangeFeedEnabled) {
+                        SyncViewModelSnapshot(false);
+                    } else if (m_snapshotInstance) {
+                        // Feed turned off: drop the snapshot, so turning it
+                        // back on starts from fresh values rather than
+                        // reporting everything that changed in between
+                        m_snapshotInstance = nullptr;
+                        m_valueSnapshot.clear();
+                        m_valueSnapshot.shrink_to_fit();
+                    }
+                    ProcessInputQueue();
+                } else {
+                    // Clear input queue if not ready to process
+                    std::lock_guard<std::mutex> inputLock(m_inputQueueMutex);
+                    while (!m_inputQueue.empty()) {
+                        m_inputQueue.pop();
+                    }
+                }
+#else
+                // Clear input queue if Rive is not available
                 std::lock_guard<std::mutex> inputLock(m_inputQueueMutex);
                 while (!m_inputQueue.empty()) {
                     m_inputQueue.pop();
                 }
-            }
-#else
-            // Clear input queue if Rive is not available
-            std::lock_guard<std::mutex> inputLock(m_inputQueueMutex);
-            while (!m_inputQueue.empty()) {
-                m_inputQueue.pop();
-            }
 #endif
-            
-            RenderRive();
+                
+                RenderRive();
+                PrepareResetSpare();
+            } else {
+                // Time spent paused isn't owed to a fixed-step simulation
+                m_stepClock.Restart();
+            }
         }
         
         std::this_thread::sleep_for(std::chrono::milliseconds(16)); // ~60 FPS
@@ -746,12 +1314,15 @@ void RiveRenderer::RenderRive()
         // Advance animation/state machine - only if active
         if (m_activeStateMachine && m_stateMachineActive) {
             // For state machines, advance only if active
-            m_scene->advanceAndApply(1.0f / 60.0f);
+            AdvanceScene();
         } else if (!m_activeStateMachine) {
             // For regular animations, always advance
-            m_scene->advanceAndApply(1.0f / 60.0f);
+            AdvanceScene();
+        } else {
+            // If state machine is paused (m_stateMachineActive == false), don't
+            // advance, and don't count the paused time as owed steps
+            m_stepClock.Restart();
         }
-        // If state machine is paused (m_stateMachineActive == false), don't advance
         
         // Calculate transform to fit content
         rive::Mat2D transform = rive::computeAlignment(
@@ -847,62 +1418,391 @@ void RiveRenderer::QueuePointerPress(float x, float y)
     m_inputQueue.push(event);
 }
 
-void RiveRenderer::QueuePointerRelease(float x, float y)
+void RiveRenderer::QueuePointerRelease(float x, float y)
+{
+    std::lock_guard<std::mutex> lock(m_inputQueueMutex);
+    MouseInputEvent event;
+    event.type = MouseInputEvent::Release;
+    event.x = x;
+    event.y = y;
+    event.timestamp = std::chrono::steady_clock::now();
+    m_inputQueue.push(event);
+}
+
+// Input processing
+void RiveRenderer::ProcessInputQueue()
+{
+    std::lock_guard<std::mutex> lock(m_inputQueueMutex);
+    
+    // Early exit if no Rive content is loaded
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (!m_scene || !m_artboard) {
+        // Clear the queue but don't process events
+        while (!m_inputQueue.empty()) {
+            m_inputQueue.pop();
+        }
+        return;
+    }
+#else
+    // Clear the queue if Rive is not available
+    while (!m_inputQueue.empty()) {
+        m_inputQueue.pop();
+    }
+    return;
+#endif
+    
+    while (!m_inputQueue.empty()) {
+        MouseInputEvent event = m_inputQueue.front();
+        m_inputQueue.pop();
+        
+        // Transform coordinates to artboard space
+        float artboardX = event.x;
+        float artboardY = event.y;
+        
+        if (TransformToArtboardSpace(artboardX, artboardY)) {
+            // Forward to state machine if available
+            bool isDown = (event.type == MouseInputEvent::Press) ? true : 
+                         (event.type == MouseInputEvent::Release) ? false : m_lastPointerDown;
+            
+            ForwardPointerEventToStateMachine(artboardX, artboardY, isDown);
+            
+            // Update pointer state tracking
+            if (event.type == MouseInputEvent::Press) {
+                m_lastPointerDown = true;
+            } else if (event.type == MouseInputEvent::Release) {
+                m_lastPointerDown = false;
+            }
+        }
+    }
+}
+
+void RiveRenderer::CommitInputBatch(std::vector<InputUpdate> batch)
+{
+    if (batch.empty()) {
+        return;
+    }
+
+    PostCommand([this, batch = std::move(batch)]() {
+        ApplyInputUpdates(batch);
+    });
+}
+
+void RiveRenderer::ApplyInputUpdates(const std::vector<InputUpdate>& batch)
+{
+    for (const auto& update : batch) {
+        switch (update.kind) {
+        case InputUpdate::Kind::Boolean:
+            SetBooleanInputByHandle(update.handle, update.value != 0.0);
+            break;
+        case InputUpdate::Kind::Number:
+            SetNumberInputByHandle(update.handle, update.value);
+            break;
+        case InputUpdate::Kind::Trigger:
+            FireTriggerByHandle(update.handle);
+            break;
+        }
+    }
+}
+
+void RiveRenderer::SetFixedTimestep(float stepSeconds, int maxCatchUpSteps)
+{
+    PostCommand([this, stepSeconds, maxCatchUpSteps]() {
+        m_stepClock.Configure(stepSeconds, maxCatchUpSteps);
+    });
+}
+
+void RiveRenderer::SetTimeScale(float scale)
+{
+    m_timeScale = std::isfinite(scale) ? std::max(scale, 0.0f) : 0.0f;
+}
+
+bool RiveRenderer::SeekAnimation(float seconds)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (!m_animationInstance || m_scene != m_animationInstance || !std::isfinite(seconds)) {
+        return false;
+    }
+    
+    // Setting the time directly and applying once costs one frame no matter
+    // how far the target is; a zero advance wraps the time for looping
+    // animations the same way playback would
+    m_animationInstance->time(std::clamp(seconds, 0.0f, m_animationInstance->durationSeconds()));
+    m_animationInstance->advanceAndApply(0.0f);
+    m_stepClock.Restart();
+    return true;
+#else
+    (void)seconds; // Unused parameter when Rive headers not available
+    return false;
+#endif
+}
+
+float RiveRenderer::GetAnimationTime()
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (m_animationInstance && m_scene == m_animationInstance) {
+        return m_animationInstance->time();
+    }
+#endif
+    return 0.0f;
+}
+
+float RiveRenderer::GetAnimationDuration()
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (m_animationInstance && m_scene == m_animationInstance) {
+        return m_animationInstance->durationSeconds();
+    }
+#endif
+    return 0.0f;
+}
+
+void RiveRenderer::AdvanceScene()
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    // Counted once per frame however many fixed steps it runs, so the
+    // notifications of every step in it carry the same frame number
+    ++m_frameNumber;
+
+    // The change feed baseline was taken before pointer input (see
+    // RenderLoop), so the diff after the advance only sees the runtime's own
+    // changes
+    const bool detectChanges = m_viewModelChangeFeedEnabled;
+
+    const float timeScale = m_timeScale;
+    if (!m_stepClock.IsEnabled()) {
+        m_scene->advanceAndApply(timeScale / 60.0f);
+        CollectNotifications();
+        if (detectChanges) {
+            SyncViewModelSnapshot(true);
+        }
+        return;
+    }
+    
+    // Reports only cover one advance, so they're collected after each step
+    int steps = m_stepClock.Tick(std::chrono::steady_clock::now(), timeScale);
+    for (int i = 0; i < steps; ++i) {
+        m_scene->advanceAndApply(m_stepClock.StepSeconds());
+        CollectNotifications();
+    }
+
+    // Even without a step, pointer listeners may have changed values
+    if (detectChanges) {
+        SyncViewModelSnapshot(true);
+    }
+#endif
+}
+
+void RiveRenderer::SetViewModelChangesAvailableCallback(std::function<bool()> callback)
+{
+    std::lock_guard<std::mutex> lock(m_viewModelChangeMutex);
+    m_viewModelChangeFeedEnabled = static_cast<bool>(callback);
+    m_viewModelChangesAvailableCallback = std::move(callback);
+    if (!m_viewModelChangeFeedEnabled) {
+        // Nobody is left to take these
+        m_pendingViewModelChanges.clear();
+        m_viewModelChangePending.clear();
+        m_viewModelChangesSignalled = false;
+    }
+}
+
+size_t RiveRenderer::TakeViewModelChanges(std::vector<uint32_t>& changedIndices)
+{
+    std::lock_guard<std::mutex> lock(m_viewModelChangeMutex);
+    changedIndices.clear();
+    changedIndices.swap(m_pendingViewModelChanges);
+    for (uint32_t index : changedIndices) {
+        m_viewModelChangePending[index] = false;
+    }
+    m_viewModelChangesSignalled = false;
+    return changedIndices.size();
+}
+
+void RiveRenderer::SyncViewModelSnapshot(bool report)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    // A different instance (or none) starts a fresh snapshot; its values are
+    // a rebind, not a change
+    if (m_snapshotInstance != m_viewModelInstance) {
+        m_snapshotInstance = m_viewModelInstance;
+        m_valueSnapshot.clear();
+        report = false;
+
+        std::lock_guard<std::mutex> lock(m_viewModelChangeMutex);
+        m_pendingViewModelChanges.clear();
+        m_viewModelChangePending.clear();
+    }
+    if (!m_snapshotInstance) {
+        return;
+    }
+
+    const auto& values = m_snapshotInstance->propertyValues();
+    if (m_valueSnapshot.size() != values.size()) {
+        m_valueSnapshot.resize(values.size());
+        report = false;
+    }
+
+    // Compared in place, without allocating unless a string changed
+    auto& changed = m_valueChangeScratch;
+    changed.clear();
+    for (size_t i = 0; i < values.size(); ++i) {
+        auto value = values[i];
+        auto& snapshot = m_valueSnapshot[i];
+        bool differs = false;
+        if (!value) {
+            continue;
+        }
+
+        if (value->is<rive::ViewModelInstanceString>()) {
+            const auto& text = value->as<rive::ViewModelInstanceString>()->propertyValue();
+            if (snapshot.text != text) {
+                snapshot.text = text;
+                differs = true;
+            }
+        } else {
+            double number;
+            if (value->is<rive::ViewModelInstanceNumber>()) {
+                number = value->as<rive::ViewModelInstanceNumber>()->propertyValue();
+            } else if (value->is<rive::ViewModelInstanceBoolean>()) {
+                number = value->as<rive::ViewModelInstanceBoolean>()->propertyValue() ? 1.0 : 0.0;
+            } else if (value->is<rive::ViewModelInstanceColor>()) {
+                number = static_cast<uint32_t>(value->as<rive::ViewModelInstanceColor>()->propertyValue());
+            } else if (value->is<rive::ViewModelInstanceEnum>()) {
+                number = value->as<rive::ViewModelInstanceEnum>()->propertyValue();
+            } else {
+                continue; // Triggers, lists and nested instances carry no comparable value
+            }
+            if (snapshot.number != number) {
+                snapshot.number = number;
+                differs = true;
+            }
+        }
+
+        if (differs && report) {
+            changed.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    if (changed.empty()) {
+        return;
+    }
+
+    std::function<bool()> callback;
+    {
+        std::lock_guard<std::mutex> lock(m_viewModelChangeMutex);
+        if (m_viewModelChangePending.size() < values.size()) {
+            m_viewModelChangePending.resize(values.size(), false);
+        }
+        for (uint32_t index : changed) {
+            if (!m_viewModelChangePending[index]) {
+                m_viewModelChangePending[index] = true;
+                m_pendingViewModelChanges.push_back(index);
+            }
+        }
+        if (!m_viewModelChangesSignalled) {
+            m_viewModelChangesSignalled = true;
+            callback = m_viewModelChangesAvailableCallback;
+        }
+    }
+
+    // As with notifications, a signal the host couldn't queue is retried
+    if (callback && !callback()) {
+        std::lock_guard<std::mutex> lock(m_viewModelChangeMutex);
+        m_viewModelChangesSignalled = false;
+    }
+#else
+    (void)report; // Unused parameter when Rive headers not available
+#endif
+}
+
+void RiveRenderer::SetNotificationsAvailableCallback(std::function<bool()> callback)
 {
-    std::lock_guard<std::mutex> lock(m_inputQueueMutex);
-    MouseInputEvent event;
-    event.type = MouseInputEvent::Release;
-    event.x = x;
-    event.y = y;
-    event.timestamp = std::chrono::steady_clock::now();
-    m_inputQueue.push(event);
+    std::lock_guard<std::mutex> lock(m_notificationMutex);
+    m_notificationsAvailableCallback = std::move(callback);
 }
 
-// Input processing
-void RiveRenderer::ProcessInputQueue()
+size_t RiveRenderer::TakeNotifications(std::vector<StateMachineNotification>& notifications)
+{
+    std::lock_guard<std::mutex> lock(m_notificationMutex);
+    size_t count = m_pendingNotifications.Take(notifications);
+    m_notificationsSignalled = false;
+    return count;
+}
+
+void RiveRenderer::CollectNotifications()
 {
-    std::lock_guard<std::mutex> lock(m_inputQueueMutex);
-    
-    // Early exit if no Rive content is loaded
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (!m_scene || !m_artboard) {
-        // Clear the queue but don't process events
-        while (!m_inputQueue.empty()) {
-            m_inputQueue.pop();
-        }
+    // Called right after the active state machine advanced; its reports only
+    // cover that advance
+    if (!m_activeStateMachine) {
         return;
     }
-#else
-    // Clear the queue if Rive is not available
-    while (!m_inputQueue.empty()) {
-        m_inputQueue.pop();
+    
+    size_t eventCount = m_activeStateMachine->reportedEventCount();
+    size_t stateCount = m_activeStateMachine->stateChangedCount();
+    if (eventCount == 0 && stateCount == 0) {
+        return;
     }
-    return;
-#endif
     
-    while (!m_inputQueue.empty()) {
-        MouseInputEvent event = m_inputQueue.front();
-        m_inputQueue.pop();
+    std::function<bool()> callback;
+    {
+        std::lock_guard<std::mutex> lock(m_notificationMutex);
         
-        // Transform coordinates to artboard space
-        float artboardX = event.x;
-        float artboardY = event.y;
+        // Slots keep their strings between frames (see SlotBuffer). One is
+        // only taken for a report that fills it, so no slot goes out holding
+        // an earlier frame's notification.
+        for (size_t i = 0; i < eventCount; ++i) {
+            auto report = m_activeStateMachine->reportedEventAt(i);
+            if (!report.event()) {
+                continue;
+            }
+            auto* slot = m_pendingNotifications.Next();
+            if (!slot) {
+                break;
+            }
+            slot->kind = StateMachineNotification::Kind::Event;
+            slot->frame = m_frameNumber;
+            slot->name.assign(report.event()->name());
+            slot->secondsDelay = report.secondsDelay();
+        }
         
-        if (TransformToArtboardSpace(artboardX, artboardY)) {
-            // Forward to state machine if available
-            bool isDown = (event.type == MouseInputEvent::Press) ? true : 
-                         (event.type == MouseInputEvent::Release) ? false : m_lastPointerDown;
-            
-            ForwardPointerEventToStateMachine(artboardX, artboardY, isDown);
-            
-            // Update pointer state tracking
-            if (event.type == MouseInputEvent::Press) {
-                m_lastPointerDown = true;
-            } else if (event.type == MouseInputEvent::Release) {
-                m_lastPointerDown = false;
+        for (size_t i = 0; i < stateCount; ++i) {
+            const rive::LayerState* state = m_activeStateMachine->stateChangedByIndex(i);
+            if (!state) {
+                continue;
+            }
+            auto* slot = m_pendingNotifications.Next();
+            if (!slot) {
+                break;
+            }
+            slot->kind = StateMachineNotification::Kind::StateChanged;
+            slot->frame = m_frameNumber;
+            slot->secondsDelay = 0.0f;
+            if (state->is<rive::AnimationState>()) {
+                auto animation = state->as<rive::AnimationState>()->animation();
+                slot->name.assign(animation ? animation->name() : std::string());
+            } else if (state->is<rive::EntryState>()) {
+                slot->name.assign("Entry");
+            } else if (state->is<rive::ExitState>()) {
+                slot->name.assign("Exit");
+            } else if (state->is<rive::AnyState>()) {
+                slot->name.assign("Any");
+            } else {
+                slot->name.clear();
             }
         }
+        
+        if (m_pendingNotifications.Count() > 0 && !m_notificationsSignalled) {
+            m_notificationsSignalled = true;
+            callback = m_notificationsAvailableCallback;
+        }
+    }
+    
+    // A signal the host couldn't queue is retried after a later frame; the
+    // notifications stay pending until then
+    if (callback && !callback()) {
+        std::lock_guard<std::mutex> lock(m_notificationMutex);
+        m_notificationsSignalled = false;
     }
+#endif
 }
 
 void RiveRenderer::ForwardPointerEventToStateMachine(float x, float y, bool isDown)
@@ -981,22 +1881,29 @@ void RiveRenderer::CleanupRenderingResources()
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
     // Clear state machines first
-    m_stateMachines.clear();
-    m_activeStateMachine = nullptr;
-    m_activeStateMachineIndex = -1;
+    ClearResidentStateMachines();
     m_defaultStateMachineIndex = -1;
     m_stateMachineActive = false;
     
     m_riveRenderer = nullptr;
     m_riveRenderTarget = nullptr;
-    m_riveRenderContext = nullptr;
+    {
+        std::lock_guard<std::mutex> contextLock(m_renderContextMutex);
+        m_riveRenderContext = nullptr;
+        ++m_renderContextGeneration;
+    }
     m_viewModelInstance = nullptr;
+    m_snapshotInstance = nullptr;
     m_scene = nullptr;
+    m_ownedScene = nullptr;
+    m_animationInstance = nullptr;
     m_artboard = nullptr;
     m_riveFile = nullptr;
 #endif
-    m_riveFileData.clear();
+    m_riveFileData.reset();
     m_riveFilePath.clear();
+    m_riveArchive.reset();
+    m_riveArchiveEntry = {};
 }
 
 // State machine management implementation
@@ -1004,9 +1911,8 @@ void RiveRenderer::EnumerateAndInitializeStateMachines()
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
     // Clear existing state machines
-    m_stateMachines.clear();
-    m_activeStateMachine = nullptr;
-    m_activeStateMachineIndex = -1;
+    ClearResidentStateMachines();
+    m_scene = m_ownedScene.get();
     m_defaultStateMachineIndex = -1;
     m_stateMachineActive = false;
     
@@ -1031,15 +1937,19 @@ void RiveRenderer::EnumerateAndInitializeStateMachines()
             std::cout << "No default state machine specified, using first one\n";
         }
         
-        // Following path_fiddle pattern: we don't enumerate state machines beforehand
-        // Instead, we create them on-demand when SetActiveStateMachine is called
-        // For now, just store placeholder entries to maintain the API
+        // Following path_fiddle pattern: we don't instantiate state machines beforehand
+        // Instead, we create them on first activation and keep them resident
+        m_stateMachines.resize(stateMachineCount);
+        auto infos = std::make_shared<std::vector<StateMachineInfo>>();
+        infos->reserve(stateMachineCount);
         for (size_t i = 0; i < stateMachineCount; ++i) {
             std::string smName = m_artboard->stateMachineNameAt(i);
             std::cout << "Found state machine " << i << ": " << smName << "\n";
-            
-            // Store placeholder - we'll create the actual instance when needed
-            m_stateMachines.push_back(nullptr);
+            infos->push_back({ std::move(smName), static_cast<int>(i), static_cast<int>(i) == m_defaultStateMachineIndex });
+        }
+        {
+            std::lock_guard<std::mutex> lock(m_metadataMutex);
+            m_stateMachineInfos = std::move(infos);
         }
         
         std::cout << "State machine enumeration completed - found " << m_stateMachines.size() << " state machines\n";
@@ -1050,17 +1960,20 @@ void RiveRenderer::EnumerateAndInitializeStateMachines()
         }
 
         int viewModelId = m_artboard.get()->viewModelId();
-        m_viewModelInstances.push_back(
-            viewModelId == -1
+        // Held only by the binding - replaced when the host binds its own
+        auto defaultInstance = viewModelId == -1
             ? m_riveFile->createViewModelInstance(m_artboard.get())
-            : m_riveFile->createViewModelInstance(viewModelId, 0));
-        m_artboard->bindViewModelInstance(m_viewModelInstances.back());
-        if (m_viewModelInstances.back() != nullptr)
+            : m_riveFile->createViewModelInstance(viewModelId, 0);
+        m_artboard->bindViewModelInstance(defaultInstance);
+        if (defaultInstance != nullptr && m_scene)
         {
-            m_scene->bindViewModelInstance(m_viewModelInstances.back());
+            m_scene->bindViewModelInstance(defaultInstance);
+            if (m_activeStateMachineIndex >= 0) {
+                m_stateMachines[m_activeStateMachineIndex].boundViewModel = defaultInstance.get();
+            }
         }
 
-		m_viewModelInstance = m_viewModelInstances.back();
+		m_viewModelInstance = defaultInstance;
         if (m_viewModelInstance != nullptr)
         {
             auto thing = m_viewModelInstance->propertyValue("MyName");
@@ -1080,24 +1993,14 @@ void RiveRenderer::EnumerateAndInitializeStateMachines()
 #endif
 }
 
-std::vector<RiveRenderer::StateMachineInfo> RiveRenderer::EnumerateStateMachines()
+std::shared_ptr<const std::vector<RiveRenderer::StateMachineInfo>> RiveRenderer::EnumerateStateMachines()
 {
-    std::vector<StateMachineInfo> result;
-    
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    // Return info about stored state machines using cached names from artboard
-    if (m_artboard) {
-        for (size_t i = 0; i < m_stateMachines.size(); ++i) {
-            StateMachineInfo info;
-            info.name = m_artboard->stateMachineNameAt(i);
-            info.index = static_cast<int>(i);
-            info.isDefault = (static_cast<int>(i) == m_defaultStateMachineIndex);
-            result.push_back(info);
-        }
+    std::lock_guard<std::mutex> lock(m_metadataMutex);
+    if (!m_stateMachineInfos) {
+        static const auto empty = std::make_shared<const std::vector<StateMachineInfo>>();
+        return empty;
     }
-#endif
-    
-    return result;
+    return m_stateMachineInfos;
 }
 
 RiveRenderer::StateMachineInfo RiveRenderer::GetDefaultStateMachine()
@@ -1107,24 +2010,21 @@ RiveRenderer::StateMachineInfo RiveRenderer::GetDefaultStateMachine()
     defaultInfo.index = -1;
     defaultInfo.isDefault = false;
     
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (m_defaultStateMachineIndex >= 0 && m_defaultStateMachineIndex < static_cast<int>(m_stateMachines.size()) && m_artboard) {
-        defaultInfo.name = m_artboard->stateMachineNameAt(m_defaultStateMachineIndex);
-        defaultInfo.index = m_defaultStateMachineIndex;
-        defaultInfo.isDefault = true;
+    for (const auto& info : *EnumerateStateMachines()) {
+        if (info.isDefault) {
+            defaultInfo = info;
+            break;
+        }
     }
-#endif
     
     return defaultInfo;
 }
 
 int RiveRenderer::GetStateMachineCount()
 {
-#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    return static_cast<int>(m_stateMachines.size());
-#else
-    return 0;
-#endif
+    // From the published metadata rather than m_stateMachines, which the
+    // render thread resizes on load and reload
+    return static_cast<int>(EnumerateStateMachines()->size());
 }
 
 bool RiveRenderer::SetActiveStateMachine(int index)
@@ -1135,32 +2035,48 @@ bool RiveRenderer::SetActiveStateMachine(int index)
         return false;
     }
     
-    // Create state machine instance on-demand using ArtboardInstance API
-    auto stateMachineInstance = m_artboard->stateMachineAt(index);
-    if (!stateMachineInstance) {
-        std::cout << "Failed to create state machine at index: " << index << std::endl;
-        return false;
+    auto& resident = m_stateMachines[index];
+    const bool wasResident = resident.instance != nullptr;
+    if (!wasResident) {
+        // Create state machine instance on first use using ArtboardInstance API
+        resident.instance = m_artboard->stateMachineAt(index);
+        if (!resident.instance) {
+            std::cout << "Failed to create state machine at index: " << index << std::endl;
+            return false;
+        }
+        resident.boundViewModel = nullptr;
+    }
+    resident.lastUsed = ++m_stateMachineUseCounter;
+    
+    // Already active - nothing to swap, and the input handles stay valid
+    if (m_activeStateMachine == resident.instance.get()) {
+        m_stateMachineActive = true;
+        return true;
     }
     
     // Set the active state machine index
     m_activeStateMachineIndex = index;
     
-    // Replace the current scene with the state machine instance
-    // StateMachineInstance inherits from Scene
-    m_scene = std::move(stateMachineInstance);
-    
-    // Update the active state machine pointer
-    m_activeStateMachine = static_cast<rive::StateMachineInstance*>(m_scene.get());
+    // Point the scene at the resident instance (StateMachineInstance inherits
+    // from Scene); a linear animation fallback is no longer needed
+    m_activeStateMachine = resident.instance.get();
+    m_scene = m_activeStateMachine;
+    m_ownedScene = nullptr;
+    m_animationInstance = nullptr;
+    RebuildInputIndex();
     
-    // Bind view model instance if available
-    if (m_viewModelInstance != nullptr) {
+    // Bind view model instance if available and not bound to this instance yet
+    if (m_viewModelInstance != nullptr && resident.boundViewModel != m_viewModelInstance.get()) {
         m_scene->bindViewModelInstance(m_viewModelInstance);  
+        resident.boundViewModel = m_viewModelInstance.get();
     }
     
     m_stateMachineActive = true;
+    EvictResidentStateMachines();
     
     std::string smName = m_artboard->stateMachineNameAt(index);
-    std::cout << "Activated state machine at index " << index << " (" << smName << ")" << std::endl;
+    std::cout << "Activated state machine at index " << index << " (" << smName << ")"
+              << (wasResident ? " from cache" : "") << std::endl;
     return true;
 #endif
     
@@ -1170,7 +2086,7 @@ bool RiveRenderer::SetActiveStateMachine(int index)
 bool RiveRenderer::SetActiveStateMachineByName(const std::string& name)
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    // Look up state machine by name from artboard (since instances are placeholders)
+    // Look up state machine by name from artboard (instances may not be resident)
     if (m_artboard) {
         for (size_t i = 0; i < m_stateMachines.size(); ++i) {
             std::string smName = m_artboard->stateMachineNameAt(i);
@@ -1221,16 +2137,29 @@ void RiveRenderer::ResetStateMachine()
     if (m_activeStateMachine && m_activeStateMachineIndex >= 0) {
         std::cout << "Resetting state machine at index " << m_activeStateMachineIndex << std::endl;
         
-        // Recreate the state machine to reset its state
-        auto stateMachineInstance = m_artboard->stateMachineAt(m_activeStateMachineIndex);
+        // The runtime can't rewind layers in place, so a reset is a fresh
+        // instance - the slot's spare when one was prepared, created here
+        // otherwise
+        auto& resident = m_stateMachines[m_activeStateMachineIndex];
+        auto stateMachineInstance = std::move(resident.resetSpare);
+        if (!stateMachineInstance) {
+            stateMachineInstance = m_artboard->stateMachineAt(m_activeStateMachineIndex);
+        }
+        
         if (stateMachineInstance) {
-            // Replace the current scene with the fresh state machine instance
-            m_scene = std::move(stateMachineInstance);
-            m_activeStateMachine = static_cast<rive::StateMachineInstance*>(m_scene.get());
+            // Replace the resident instance with the fresh one; the old one
+            // drops its view model binding as it's destroyed
+            resident.instance = std::move(stateMachineInstance);
+            resident.boundViewModel = nullptr;
+            resident.wantsResetSpare = true;
+            m_activeStateMachine = resident.instance.get();
+            m_scene = m_activeStateMachine;
+            RebuildInputIndex();
             
             // Bind view model instance if available
             if (m_viewModelInstance != nullptr) {
                 m_scene->bindViewModelInstance(m_viewModelInstance);  
+                resident.boundViewModel = m_viewModelInstance.get();
             }
             
             std::cout << "State machine reset successfully\n";
@@ -1252,119 +2181,345 @@ bool RiveRenderer::IsStateMachineActive()
 #endif
 }
 
-std::vector<RiveRenderer::StateMachineInputInfo> RiveRenderer::GetStateMachineInputs()
+void RiveRenderer::SetStateMachineCacheCapacity(size_t bytes)
+{
+    PostCommand([this, bytes]() {
+        m_stateMachineCacheCapacity = bytes;
+        EvictResidentStateMachines();
+    });
+}
+
+size_t RiveRenderer::GetResidentStateMachineCount()
+{
+    size_t count = 0;
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    for (const auto& resident : m_stateMachines) {
+        if (resident.instance) {
+            ++count;
+        }
+    }
+#endif
+    return count;
+}
+
+size_t RiveRenderer::ResidentStateMachineBytes() const
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    return SumResidentBytes(m_stateMachines, EstimateStateMachineBytes);
+#else
+    return 0;
+#endif
+}
+
+void RiveRenderer::EvictResidentStateMachines()
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    EvictLeastRecentlyUsed(m_stateMachines, m_activeStateMachine, m_stateMachineCacheCapacity,
+                           EstimateStateMachineBytes, [](ResidentStateMachine& resident) {
+                               resident.boundViewModel = nullptr;
+                               resident.wantsResetSpare = false;
+                           });
+#endif
+}
+
+void RiveRenderer::PrepareResetSpare()
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    // Runs after a frame was presented, so building the spare lands in idle
+    // time rather than on the frame that resets. Only slots that have been
+    // reset get one, and only while it fits in the cache capacity - a spare
+    // never evicts a resident instance.
+    if (!m_artboard || m_activeStateMachineIndex < 0) {
+        return;
+    }
+    auto& resident = m_stateMachines[m_activeStateMachineIndex];
+    if (!resident.wantsResetSpare || resident.resetSpare || !resident.instance) {
+        return;
+    }
+    if (ResidentStateMachineBytes() + EstimateStateMachineBytes(resident.instance.get()) >
+        m_stateMachineCacheCapacity) {
+        return;
+    }
+
+    // Left unbound: binding happens when it's swapped in, so only the live
+    // instance ever observes the shared view model
+    resident.resetSpare = m_artboard->stateMachineAt(m_activeStateMachineIndex);
+#endif
+}
+
+void RiveRenderer::ClearResidentStateMachines()
 {
-    std::vector<StateMachineInputInfo> result;
-    
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
     if (m_activeStateMachine) {
-        size_t inputCount = m_activeStateMachine->inputCount();
-        for (size_t i = 0; i < inputCount; ++i) {
-            auto input = m_activeStateMachine->input(i);
-            if (input) {
-                StateMachineInputInfo info;
-                info.name = input->name();
-                
-                // Determine input type and get current values using static_cast pattern
-                auto boolInput = static_cast<rive::SMIBool*>(input);
-                if (boolInput) {
-                    info.type = "Boolean";
-                    info.booleanValue = boolInput->value();
-                    info.numberValue = 0.0;
-                } else {
-                    auto numberInput = static_cast<rive::SMINumber*>(input);
-                    if (numberInput) {
-                        info.type = "Number";
-                        info.booleanValue = false;
-                        info.numberValue = numberInput->value();
-                    } else {
-                        auto triggerInput = static_cast<rive::SMITrigger*>(input);
-                        if (triggerInput) {
-                            info.type = "Trigger";
-                            info.booleanValue = false;
-                            info.numberValue = 0.0;
-                        } else {
-                            info.type = "Unknown";
-                            info.booleanValue = false;
-                            info.numberValue = 0.0;
-                        }
-                    }
-                }
-                
-                result.push_back(info);
+        m_scene = nullptr;
+    }
+    m_activeStateMachine = nullptr;
+    m_activeStateMachineIndex = -1;
+    m_stateMachines.clear();
+    RebuildInputIndex();
+    
+    std::lock_guard<std::mutex> lock(m_metadataMutex);
+    m_stateMachineInfos = nullptr;
+#endif
+}
+
+std::shared_ptr<const std::vector<RiveRenderer::StateMachineInputInfo>> RiveRenderer::GetStateMachineInputs()
+{
+    if (!m_inputInfos) {
+        static const auto empty = std::make_shared<const std::vector<StateMachineInputInfo>>();
+        return empty;
+    }
+    
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    // Names and types never change for an activated machine; only a value
+    // change costs a new collection
+    auto valuesOf = [](const InputIndexEntry& source, bool& booleanValue, double& numberValue) {
+        booleanValue = false;
+        numberValue = 0.0;
+        if (source.coreType == rive::StateMachineBool::typeKey) {
+            booleanValue = static_cast<rive::SMIBool*>(source.input)->value();
+        } else if (source.coreType == rive::StateMachineNumber::typeKey) {
+            numberValue = static_cast<rive::SMINumber*>(source.input)->value();
+        }
+    };
+    
+    const auto& cached = *m_inputInfos;
+    for (size_t i = 0; i < cached.size(); ++i) {
+        bool booleanValue;
+        double numberValue;
+        valuesOf(m_inputInfoSources[i], booleanValue, numberValue);
+        if (booleanValue != cached[i].booleanValue || numberValue != cached[i].numberValue) {
+            auto updated = std::make_shared<std::vector<StateMachineInputInfo>>(cached);
+            for (size_t j = i; j < updated->size(); ++j) {
+                valuesOf(m_inputInfoSources[j], (*updated)[j].booleanValue, (*updated)[j].numberValue);
             }
+            m_inputInfos = std::move(updated);
+            break;
         }
     }
 #endif
     
-    return result;
+    return m_inputInfos;
 }
 
-bool RiveRenderer::SetBooleanInput(const std::string& name, bool value)
+void RiveRenderer::RebuildInputIndex()
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    m_inputs.clear();
+    m_inputIndex.clear();
+    m_inputInfoSources.clear();
+    m_inputInfos = nullptr;
+
+    // Generation 0 is skipped so a zeroed handle never validates
+    if (++m_inputGeneration == 0) {
+        m_inputGeneration = 1;
+    }
+
     if (!m_activeStateMachine) {
-        return false;
+        std::lock_guard<std::mutex> lock(m_metadataMutex);
+        m_inputSchema = nullptr;
+        return;
     }
-    
+
+    // Handles carry the slot plus one in their low 32 bits, so every input a
+    // state machine could hold gets one; anything past that is reported
+    // rather than silently left out of the index
     size_t inputCount = m_activeStateMachine->inputCount();
+    constexpr size_t kMaxIndexedInputs = UINT32_MAX - 1;
+    if (inputCount > kMaxIndexedInputs) {
+        std::cout << "State machine has " << inputCount << " inputs; only the first "
+                  << kMaxIndexedInputs << " can be addressed by name or handle" << std::endl;
+        inputCount = kMaxIndexedInputs;
+    }
+    auto schema = std::make_shared<InputSchema>();
+    schema->reserve(inputCount);
+    m_inputs.reserve(inputCount);
+    m_inputIndex.reserve(inputCount);
+    auto infos = std::make_shared<std::vector<StateMachineInputInfo>>();
+    infos->reserve(inputCount);
+    m_inputInfoSources.reserve(inputCount);
     for (size_t i = 0; i < inputCount; ++i) {
         auto input = m_activeStateMachine->input(i);
-        if (input && input->name() == name) {
-            auto boolInput = static_cast<rive::SMIBool*>(input);
-            if (boolInput) {
-                boolInput->value(value);
-                return true;
+        if (input) {
+            const uint16_t coreType = input->inputCoreType();
+            // First input wins on duplicate names, matching the old linear scan
+            const uint32_t slot = static_cast<uint32_t>(m_inputs.size());
+            if (m_inputIndex.try_emplace(input->name(), slot).second) {
+                m_inputs.push_back({ input, coreType });
+                const uint64_t handle = (static_cast<uint64_t>(m_inputGeneration) << 32) | (slot + 1);
+                if (coreType == rive::StateMachineBool::typeKey) {
+                    schema->emplace(input->name(), PublishedInput{ InputUpdate::Kind::Boolean, handle });
+                } else if (coreType == rive::StateMachineNumber::typeKey) {
+                    schema->emplace(input->name(), PublishedInput{ InputUpdate::Kind::Number, handle });
+                } else if (coreType == rive::StateMachineTrigger::typeKey) {
+                    schema->emplace(input->name(), PublishedInput{ InputUpdate::Kind::Trigger, handle });
+                }
+            }
+            
+            StateMachineInputInfo info;
+            info.name = input->name();
+            info.booleanValue = false;
+            info.numberValue = 0.0;
+            if (coreType == rive::StateMachineBool::typeKey) {
+                info.type = "Boolean";
+                info.booleanValue = static_cast<rive::SMIBool*>(input)->value();
+            } else if (coreType == rive::StateMachineNumber::typeKey) {
+                info.type = "Number";
+                info.numberValue = static_cast<rive::SMINumber*>(input)->value();
+            } else if (coreType == rive::StateMachineTrigger::typeKey) {
+                info.type = "Trigger";
+            } else {
+                info.type = "Unknown";
             }
+            infos->push_back(std::move(info));
+            m_inputInfoSources.push_back({ input, coreType });
         }
     }
+    m_inputInfos = std::move(infos);
+
+    std::lock_guard<std::mutex> lock(m_metadataMutex);
+    m_inputSchema = std::move(schema);
+#endif
+}
+
+bool RiveRenderer::HasInput(std::string_view name, InputUpdate::Kind kind)
+{
+    if (m_pendingActivations.load() != 0) {
+        return true;
+    }
+
+    std::shared_ptr<const InputSchema> schema;
+    {
+        std::lock_guard<std::mutex> lock(m_metadataMutex);
+        schema = m_inputSchema;
+    }
+    if (!schema) {
+        return false;
+    }
+    auto it = schema->find(name);
+    return it != schema->end() && it->second.kind == kind;
+}
+
+uint64_t RiveRenderer::FindPublishedInputHandle(std::string_view name, InputUpdate::Kind kind)
+{
+    // Pending activations replace the table, so nothing published is current
+    if (m_pendingActivations.load() != 0) {
+        return kInvalidInputHandle;
+    }
+
+    std::shared_ptr<const InputSchema> schema;
+    {
+        std::lock_guard<std::mutex> lock(m_metadataMutex);
+        schema = m_inputSchema;
+    }
+    if (!schema) {
+        return kInvalidInputHandle;
+    }
+    auto it = schema->find(name);
+    return it != schema->end() && it->second.kind == kind ? it->second.handle : kInvalidInputHandle;
+}
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+rive::SMIInput* RiveRenderer::FindInput(std::string_view name, uint16_t coreType) const
+{
+    auto it = m_inputIndex.find(name);
+    if (it == m_inputIndex.end() || m_inputs[it->second].coreType != coreType) {
+        return nullptr;
+    }
+    return m_inputs[it->second].input;
+}
+
+rive::SMIInput* RiveRenderer::FindInputByHandle(uint64_t handle, uint16_t coreType) const
+{
+    // Handle layout: generation in the high 32 bits, slot + 1 in the low 32
+    uint32_t slot = static_cast<uint32_t>(handle) - 1;
+    if (static_cast<uint32_t>(handle >> 32) != m_inputGeneration || slot >= m_inputs.size() || m_inputs[slot].coreType != coreType) {
+        return nullptr;
+    }
+    return m_inputs[slot].input;
+}
+#endif
+
+bool RiveRenderer::SetBooleanInput(std::string_view name, bool value)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (auto input = FindInput(name, rive::StateMachineBool::typeKey)) {
+        static_cast<rive::SMIBool*>(input)->value(value);
+        return true;
+    }
 #endif
     (void)name; (void)value; // Unused parameters when Rive headers not available
     return false;
 }
 
-bool RiveRenderer::SetNumberInput(const std::string& name, double value)
+bool RiveRenderer::SetNumberInput(std::string_view name, double value)
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (!m_activeStateMachine) {
-        return false;
-    }
-    
-    size_t inputCount = m_activeStateMachine->inputCount();
-    for (size_t i = 0; i < inputCount; ++i) {
-        auto input = m_activeStateMachine->input(i);
-        if (input && input->name() == name) {
-            auto numberInput = static_cast<rive::SMINumber*>(input);
-            if (numberInput) {
-                numberInput->value(static_cast<float>(value));
-                return true;
-            }
-        }
+    if (auto input = FindInput(name, rive::StateMachineNumber::typeKey)) {
+        static_cast<rive::SMINumber*>(input)->value(static_cast<float>(value));
+        return true;
     }
 #endif
     (void)name; (void)value; // Unused parameters when Rive headers not available
     return false;
 }
 
-bool RiveRenderer::FireTrigger(const std::string& name)
+bool RiveRenderer::FireTrigger(std::string_view name)
 {
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
-    if (!m_activeStateMachine) {
-        return false;
+    if (auto input = FindInput(name, rive::StateMachineTrigger::typeKey)) {
+        static_cast<rive::SMITrigger*>(input)->fire();
+        return true;
     }
-    
-    size_t inputCount = m_activeStateMachine->inputCount();
-    for (size_t i = 0; i < inputCount; ++i) {
-        auto input = m_activeStateMachine->input(i);
-        if (input && input->name() == name) {
-            auto trigger = static_cast<rive::SMITrigger*>(input);
-            if (trigger) {
-                trigger->fire();
-                return true;
-            }
-        }
+#endif
+    (void)name; // Unused parameter when Rive headers not available
+    return false;
+}
+
+uint64_t RiveRenderer::GetInputHandle(std::string_view name)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    auto it = m_inputIndex.find(name);
+    if (it != m_inputIndex.end()) {
+        return (static_cast<uint64_t>(m_inputGeneration) << 32) | (it->second + 1);
     }
 #endif
     (void)name; // Unused parameter when Rive headers not available
+    return kInvalidInputHandle;
+}
+
+bool RiveRenderer::SetBooleanInputByHandle(uint64_t handle, bool value)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (auto input = FindInputByHandle(handle, rive::StateMachineBool::typeKey)) {
+        static_cast<rive::SMIBool*>(input)->value(value);
+        return true;
+    }
+#endif
+    (void)handle; (void)value; // Unused parameters when Rive headers not available
+    return false;
+}
+
+bool RiveRenderer::SetNumberInputByHandle(uint64_t handle, double value)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (auto input = FindInputByHandle(handle, rive::StateMachineNumber::typeKey)) {
+        static_cast<rive::SMINumber*>(input)->value(static_cast<float>(value));
+        return true;
+    }
+#endif
+    (void)handle; (void)value; // Unused parameters when Rive headers not available
+    return false;
+}
+
+bool RiveRenderer::FireTriggerByHandle(uint64_t handle)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    if (auto input = FindInputByHandle(handle, rive::StateMachineTrigger::typeKey)) {
+        static_cast<rive::SMITrigger*>(input)->fire();
+        return true;
+    }
+#endif
+    (void)handle; // Unused parameter when Rive headers not available
     return false;
 }
@@ -31,6 +31,22 @@
 #include <vector>
 #include <iostream>
 #include <queue>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <functional>
+#include <filesystem>
+
+#include "fixed_step_clock.h"
+#include "riv_archive.h"
+#include "riv_asset_cache.h"
+#include "riv_asset_loader.h"
+#include "riv_loader.h"
+#include "render_command_queue.h"
+#include "slot_buffer.h"
+#include "transparent_string_hash.h"
+#include "viewmodel_instance_registry.h"
 
 // Rive headers (only include if available)
 #if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
@@ -41,7 +57,16 @@
 #include "rive/file.hpp"
 #include "rive/animation/linear_animation_instance.hpp"
 #include "rive/animation/state_machine_instance.hpp"
+#include "rive/animation/state_machine_input_instance.hpp"
+#include "rive/animation/state_machine_bool.hpp"
+#include "rive/animation/state_machine_number.hpp"
+#include "rive/animation/state_machine_trigger.hpp"
 #include "rive/static_scene.hpp"
+#include "rive/animation/animation_state.hpp"
+#include "rive/animation/any_state.hpp"
+#include "rive/animation/entry_state.hpp"
+#include "rive/animation/exit_state.hpp"
+#include "rive/event.hpp"
 
 #include "rive/viewmodel/viewmodel.hpp"
 #include "rive/viewmodel/viewmodel_instance.hpp"
@@ -52,6 +77,21 @@
 #include "rive/viewmodel/viewmodel_instance_color.hpp"
 #include "rive/viewmodel/viewmodel_instance_enum.hpp"
 #include "rive/viewmodel/viewmodel_instance_trigger.hpp"
+#include "rive/viewmodel/viewmodel_property.hpp"
+#include "rive/viewmodel/viewmodel_property_string.hpp"
+#include "rive/viewmodel/viewmodel_property_number.hpp"
+#include "rive/viewmodel/viewmodel_property_boolean.hpp"
+#include "rive/viewmodel/viewmodel_property_color.hpp"
+#include "rive/viewmodel/viewmodel_property_enum.hpp"
+#include "rive/viewmodel/viewmodel_property_trigger.hpp"
+#include "rive/viewmodel/viewmodel_property_list.hpp"
+#include "rive/viewmodel/viewmodel_property_viewmodel.hpp"
+#endif
+
+// Hot reload of .riv files is a development aid - compiled into debug builds
+// or when WINRIVE_ENABLE_HOT_RELOAD is defined
+#if defined(_DEBUG) || defined(WINRIVE_ENABLE_HOT_RELOAD)
+#define WINRIVE_HOT_RELOAD_AVAILABLE
 #endif
 
 // Input event structure for thread-safe input handling
@@ -63,6 +103,63 @@ struct MouseInputEvent {
 };
 
 class RiveRenderer {
+public:
+    // What happens to the .riv source bytes once rive::File::import succeeds
+    enum class SourceDataPolicy {
+        Retain,   // Keep a private copy for the renderer's lifetime (default)
+        Release,  // Drop the buffer after import; a reload re-reads the file
+        Share     // Keep one buffer per path shared by every renderer that loads it
+    };
+
+    // Per-instance memory footprint. Source bytes are exact; the parsed file,
+    // instances and GPU figures are estimates since the runtime does not
+    // expose allocation sizes.
+    struct MemoryUsage {
+        size_t sourceBytes = 0;            // Source buffer owned by this renderer
+        size_t sharedSourceBytes = 0;      // Source buffer shared with other renderers
+        size_t fileBytes = 0;              // Parsed rive::File
+        size_t artboardBytes = 0;          // Artboard instance
+        size_t stateMachineBytes = 0;      // Scene / state machine instances
+        size_t viewModelInstanceBytes = 0; // View model instances held by the renderer
+        size_t gpuBytes = 0;               // Swap chain and Rive render target
+
+        size_t TotalBytes() const {
+            return sourceBytes + sharedSourceBytes + fileBytes + artboardBytes +
+                stateMachineBytes + viewModelInstanceBytes + gpuBytes;
+        }
+    };
+
+    // Something the active state machine reported while advancing a frame
+    struct StateMachineNotification {
+        enum class Kind : uint8_t { Event, StateChanged };
+        Kind kind;
+        uint64_t frame;        // Frame the notification was collected on
+        std::string name;      // Event name, or the animation of the state entered
+        float secondsDelay;    // Events only - how far into the frame it fired
+    };
+
+    // One input write in a batch, addressed by handle (see GetInputHandle)
+    struct InputUpdate {
+        enum class Kind : uint8_t { Boolean, Number, Trigger };
+        Kind kind;
+        uint64_t handle;
+        double value;   // Number value, or 0 / 1 for Boolean
+    };
+
+    // State machine metadata
+    struct StateMachineInfo {
+        std::string name;
+        int index;
+        bool isDefault;
+    };
+    
+    struct StateMachineInputInfo {
+        std::string name;
+        std::string type;
+        bool booleanValue;
+        double numberValue;
+    };
+
 private:
     // Composition API
     winrt::Windows::UI::Composition::Compositor m_compositor{ nullptr };
@@ -80,6 +177,10 @@ private:
     Microsoft::WRL::ComPtr<::ID3D11Device> m_riveGpu;
     Microsoft::WRL::ComPtr<::ID3D11DeviceContext> m_riveGpuContext;
     std::unique_ptr<rive::gpu::RenderContext> m_riveRenderContext;
+    // Guards replacing m_riveRenderContext against a hot reload importing with
+    // it off the render thread; the generation tells a stale import apart
+    std::mutex m_renderContextMutex;
+    uint32_t m_renderContextGeneration = 0;
     rive::rcp<rive::gpu::RenderTargetD3D> m_riveRenderTarget;
     std::unique_ptr<rive::Renderer> m_riveRenderer;
     
@@ -87,27 +188,126 @@ private:
     rive::rcp<rive::File> m_riveFile;
     //std::unique_ptr<rive::File> m_riveFile;
     std::unique_ptr<rive::ArtboardInstance> m_artboard;
-    std::unique_ptr<rive::Scene> m_scene;
+    // The scene being drawn - either a resident state machine below or
+    // m_ownedScene (a linear animation or static scene)
+    rive::Scene* m_scene = nullptr;
+    std::unique_ptr<rive::Scene> m_ownedScene;
+    rive::LinearAnimationInstance* m_animationInstance = nullptr;   // m_ownedScene when it's an animation
     rive::rcp<rive::ViewModelInstance> m_viewModelInstance;
+    // Instance m_valueSnapshot was taken from (see TakeViewModelChanges)
+    rive::rcp<rive::ViewModelInstance> m_snapshotInstance;
     
-    // State machine management
-    std::vector<std::unique_ptr<rive::StateMachineInstance>> m_stateMachines;
+    // State machine management. One slot per state machine in the artboard;
+    // an activated instance stays resident so switching back to it keeps its
+    // state and costs no allocation. Least recently used instances are
+    // dropped once the resident set exceeds m_stateMachineCacheCapacity.
+    //
+    // Once a slot has been reset it also keeps an unbound spare instance that
+    // the next ResetStateMachine swaps in, so repeated resets don't build the
+    // layers on the calling frame. Spares count against the same capacity,
+    // are rebuilt after a frame (see PrepareResetSpare) and go first when the
+    // cache is over budget.
+    struct ResidentStateMachine {
+        std::unique_ptr<rive::StateMachineInstance> instance;
+        uint64_t lastUsed = 0;
+        rive::ViewModelInstance* boundViewModel = nullptr;
+        std::unique_ptr<rive::StateMachineInstance> resetSpare;
+        bool wantsResetSpare = false;
+    };
+    std::vector<ResidentStateMachine> m_stateMachines;
+    uint64_t m_stateMachineUseCounter = 0;
+    size_t m_stateMachineCacheCapacity = kDefaultStateMachineCacheCapacity;
     rive::StateMachineInstance* m_activeStateMachine = nullptr;
-    std::vector<rive::rcp<rive::ViewModelInstance>> m_viewModelInstances;
     int m_activeStateMachineIndex = -1;
     int m_defaultStateMachineIndex = -1;
     bool m_stateMachineActive = false;
+
+    // Inputs of the active state machine, plus a name -> slot index - rebuilt
+    // on activation so input setters don't scan and compare every input name
+    struct InputIndexEntry {
+        rive::SMIInput* input;
+        uint16_t coreType;   // rive::StateMachineBool/Number/Trigger::typeKey
+    };
+    std::vector<InputIndexEntry> m_inputs;
+    // Every input of the active machine in order, matching m_inputInfos
+    std::vector<InputIndexEntry> m_inputInfoSources;
+    std::unordered_map<std::string, uint32_t, TransparentStringHash, std::equal_to<>> m_inputIndex;
 #endif
+    std::shared_ptr<const std::vector<StateMachineInputInfo>> m_inputInfos;
+    std::mutex m_metadataMutex;   // Guards m_stateMachineInfos and m_inputSchema
+    std::shared_ptr<const std::vector<StateMachineInfo>> m_stateMachineInfos;
+
+    // Bumped whenever the input table is rebuilt; stamped into input handles
+    uint32_t m_inputGeneration = 0;
+
+    // Input names, kinds and handles of the active machine for HasInput and
+    // FindPublishedInputHandle, replaced under m_metadataMutex whenever the
+    // input table is rebuilt
+    struct PublishedInput {
+        InputUpdate::Kind kind;
+        uint64_t handle;
+    };
+    using InputSchema = std::unordered_map<std::string, PublishedInput, TransparentStringHash, std::equal_to<>>;
+    std::shared_ptr<const InputSchema> m_inputSchema;
+    std::atomic<uint32_t> m_pendingActivations{ 0 };
     
-    // Rive file data
-    std::vector<uint8_t> m_riveFileData;
+    // Rive file data - shared so identical files loaded by several renderers
+    // can reference one buffer (see SourceDataPolicy)
+    std::shared_ptr<const std::vector<uint8_t>> m_riveFileData;
     std::string m_riveFilePath;
+
+    // Archive the content was imported from in place - holds the mapping open
+    std::shared_ptr<RivArchive> m_riveArchive;
+    RivArchive::Entry m_riveArchiveEntry;
     
     // Threading
     std::thread m_renderThread;
     std::atomic<bool> m_shouldRender{ true };
     std::atomic<bool> m_isPaused{ false };
     std::mutex m_deviceMutex;
+
+    // Scene mutations from other threads, drained by the render thread under
+    // m_deviceMutex. Shared with WinRT wrappers that post directly.
+    std::shared_ptr<RenderCommandQueue> m_commandQueue;
+
+    // View model instances created for the host, one reference per wrapper
+    std::shared_ptr<ViewModelInstanceRegistry> m_viewModelInstanceRegistry;
+    
+    SourceDataPolicy m_sourceDataPolicy = SourceDataPolicy::Retain;
+
+    // Hot reload - watcher thread polls the loaded file's write time
+    std::thread m_hotReloadThread;
+    std::atomic<bool> m_hotReloadEnabled{ false };
+    std::function<void()> m_contentReloadedCallback;
+
+    // State machine notifications waiting for the host (see TakeNotifications)
+    static constexpr size_t kMaxPendingNotifications = 1024;
+    std::mutex m_notificationMutex;
+    SlotBuffer<StateMachineNotification> m_pendingNotifications{ kMaxPendingNotifications };
+    bool m_notificationsSignalled = false;
+    uint64_t m_frameNumber = 0;     // AdvanceScene calls, not fixed steps
+    std::function<bool()> m_notificationsAvailableCallback;
+
+    // Runtime view model change feed (see TakeViewModelChanges). The snapshot
+    // is render thread only; one entry per property, holding the value as a
+    // double or, for strings, the text.
+    struct ValueSnapshot {
+        double number = 0.0;
+        std::string text;
+    };
+    std::vector<ValueSnapshot> m_valueSnapshot;
+    std::vector<uint32_t> m_valueChangeScratch;
+    std::atomic<bool> m_viewModelChangeFeedEnabled{ false };
+    std::mutex m_viewModelChangeMutex;
+    std::vector<uint32_t> m_pendingViewModelChanges;
+    std::vector<bool> m_viewModelChangePending;   // By property index
+    bool m_viewModelChangesSignalled = false;
+    std::function<bool()> m_viewModelChangesAvailableCallback;
+
+    std::atomic<float> m_timeScale{ 1.0f };
+    
+    // Fixed-step simulation (see SetFixedTimestep) - render thread only
+    FixedStepClock m_stepClock;
     
     // Rendering state
     int m_renderWidth = 800;
@@ -143,6 +343,59 @@ public:
     
     // Content management
     bool LoadRiveFile(const std::string& filePath);
+    // Import an entry of a .rivpack archive by name. Uncompressed entries are
+    // imported straight from the mapped archive without copying.
+    bool LoadRiveFileFromArchive(const std::string& archivePath, const std::string& entryName);
+
+    // Memory accounting
+    void SetSourceDataPolicy(SourceDataPolicy policy);
+    SourceDataPolicy GetSourceDataPolicy() const { return m_sourceDataPolicy; }
+    MemoryUsage GetMemoryUsage();
+
+    // Development hot reload - watches the loaded file and swaps in changes while
+    // keeping the active state machine, its input values and bound view model
+    // property values. The file is parsed on the watcher thread, holding the
+    // device lock since the render context is its factory, so frames wait out
+    // the import; it is swapped in on the render thread, which also runs the
+    // callback - hand off from there.
+    void EnableHotReload(bool enable);
+    bool IsHotReloadEnabled() const { return m_hotReloadEnabled; }
+    void SetContentReloadedCallback(std::function<void()> callback);
+    
+    // Thread-safe scene mutation. Commands run on the render thread at the top
+    // of its next frame - even while paused - or inline when no render thread
+    // is running, in the order they were posted. Don't post while holding the
+    // device lock (i.e. from inside a command or RunSynchronized).
+    void PostCommand(std::function<void()> command);
+    std::shared_ptr<RenderCommandCompletion> PostCommandWithCompletion(std::function<bool()> command);
+    std::shared_ptr<RenderCommandQueue> GetCommandQueue() const { return m_commandQueue; }
+
+    // Run a read of the scene on the calling thread under the device lock,
+    // after every command posted so far has been applied
+    void RunSynchronized(const std::function<void()>& action);
+    
+    // Simulation timing. By default every rendered frame advances the scene
+    // by 1/60 s. With a fixed step, each frame advances in whole steps of
+    // stepSeconds covering the wall-clock time since the previous frame, at
+    // most maxCatchUpSteps of them; time beyond that is dropped rather than
+    // owed, so a slow frame can't snowball. Drawing shows the latest step -
+    // the runtime has no way to blend two states. A step of 0 restores the
+    // default.
+    void SetFixedTimestep(float stepSeconds, int maxCatchUpSteps = 4);
+
+    // Playback speed for this renderer: 1 is normal, 0.5 slow motion, 2 fast
+    // forward. 0 freezes the scene while the loop keeps drawing. Negative
+    // and non-finite values are treated as 0.
+    void SetTimeScale(float scale);
+    float GetTimeScale() const { return m_timeScale; }
+
+    // Jump a linear animation scene (content without state machines) straight
+    // to an absolute time in seconds - one apply, whatever the distance.
+    // Returns false when the scene isn't a linear animation or the time isn't
+    // finite.
+    bool SeekAnimation(float seconds);
+    float GetAnimationTime();
+    float GetAnimationDuration();
     
     // Rendering control
     void StartRenderThread();
@@ -156,20 +409,12 @@ public:
     void QueuePointerRelease(float x, float y);
 
     // State machine management
-    struct StateMachineInfo {
-        std::string name;
-        int index;
-        bool isDefault;
-    };
-    
-    struct StateMachineInputInfo {
-        std::string name;
-        std::string type;
-        bool booleanValue;
-        double numberValue;
-    };
-    
-    std::vector<StateMachineInfo> EnumerateStateMachines();
+    // State machine metadata is built once per loaded file, input metadata
+    // once per activated machine. Both are handed out as shared immutable
+    // collections; a new collection only appears when something changed
+    // (for inputs, a value), so callers can compare pointers to skip work.
+    // State machine metadata and the count may be read from any thread.
+    std::shared_ptr<const std::vector<StateMachineInfo>> EnumerateStateMachines();
     StateMachineInfo GetDefaultStateMachine();
     int GetStateMachineCount();
     bool SetActiveStateMachine(int index);
@@ -177,14 +422,77 @@ public:
     int GetActiveStateMachineIndex();
     void PlayStateMachine();
     void PauseStateMachine();
+    // Restart the active state machine from its initial state. After the
+    // first reset of a machine, later ones swap in a spare built ahead of time.
     void ResetStateMachine();
     bool IsStateMachineActive();
-    std::vector<StateMachineInputInfo> GetStateMachineInputs();
-    bool SetBooleanInput(const std::string& name, bool value);
-    bool SetNumberInput(const std::string& name, double value);
-    bool FireTrigger(const std::string& name);
 
-    // ViewModel management
+    // Estimated bytes the resident state machine instances and their reset
+    // spares may hold. The
+    // active instance is never evicted, even when it alone is larger. The
+    // count is a scene read (see RunSynchronized).
+    static constexpr size_t kDefaultStateMachineCacheCapacity = 256 * 1024;
+    void SetStateMachineCacheCapacity(size_t bytes);
+    size_t GetResidentStateMachineCount();
+    std::shared_ptr<const std::vector<StateMachineInputInfo>> GetStateMachineInputs();
+    bool SetBooleanInput(std::string_view name, bool value);
+    bool SetNumberInput(std::string_view name, double value);
+    bool FireTrigger(std::string_view name);
+    // Whether the active state machine has an input of this name and kind.
+    // Reads a copy published on every activation, so any thread can check a
+    // name before posting a write without taking the device lock. While an
+    // activation posted through PostActivation is pending the answer isn't
+    // known yet and is true.
+    bool HasInput(std::string_view name, InputUpdate::Kind kind);
+    // The input's handle from the same published copy, so a write can be
+    // posted by handle with no string kept. kInvalidInputHandle when there is
+    // no such input, and while an activation is pending.
+    uint64_t FindPublishedInputHandle(std::string_view name, InputUpdate::Kind kind);
+    void PostActivation(std::function<void()> activate);
+
+    // Input handles - resolve a name once, then set by handle with no string
+    // work. A handle packs the input's slot with the generation of the active
+    // state machine, so handles taken before a switch, reset or reload are
+    // rejected. 0 is never a valid handle.
+    static constexpr uint64_t kInvalidInputHandle = 0;
+    uint64_t GetInputHandle(std::string_view name);
+    bool SetBooleanInputByHandle(uint64_t handle, bool value);
+    bool SetNumberInputByHandle(uint64_t handle, double value);
+    bool FireTriggerByHandle(uint64_t handle);
+
+    // Apply a set of input writes as one unit, as a single posted command - the
+    // whole batch lands immediately before the next advance, so no frame sees
+    // part of it. Writes with stale handles are dropped.
+    void CommitInputBatch(std::vector<InputUpdate> batch);
+
+    // Reported events and state changes, collected on the render thread after
+    // each advance. The callback runs on the render thread, under the device
+    // lock, once per frame that had any, and not again until the host has
+    // taken them. It should only queue a call to TakeNotifications on the
+    // host's own thread and return whether it could; after false a later
+    // frame signals again. The host's vector becomes the next collection
+    // buffer, so once both buffers have warmed up the render thread reuses
+    // slots and string capacity instead of allocating.
+    // Returns how many leading entries are valid.
+    void SetNotificationsAvailableCallback(std::function<bool()> callback);
+    size_t TakeNotifications(std::vector<StateMachineNotification>& notifications);
+
+    // Values of the bound view model instance changed by the runtime itself -
+    // bindings, listeners, state machine actions. The render thread diffs a
+    // snapshot of the values taken before pointer input against the values
+    // after the advance; host writes land before the snapshot, so they aren't
+    // echoed back. Like notifications, the callback runs on the render thread
+    // once per frame with changes, not again until the host takes them, and
+    // returns whether it queued the take. Entries are indices into the
+    // instance's propertyValues(), each at most once per take however often
+    // it changed. Nested instances and lists aren't diffed. Detection only
+    // runs while a callback is set; clearing it drops pending changes and the
+    // snapshot.
+    void SetViewModelChangesAvailableCallback(std::function<bool()> callback);
+    size_t TakeViewModelChanges(std::vector<uint32_t>& changedIndices);
+
+    // ViewModel management. These read the loaded file, which loads and hot
+    // reloads replace on the render thread - call them under RunSynchronized.
     struct ViewModelInfo {
         std::string name;
         int index;
@@ -196,12 +504,15 @@ public:
     ViewModelInfo GetDefaultViewModel();
     int GetViewModelCount();
     
-    // ViewModelInstance management
+    // ViewModelInstance management. Created instances are registered with one
+    // reference that the caller owns and must hand back with
+    // GetViewModelInstanceRegistry()->Release; a bound instance outlives it.
     void* CreateViewModelInstance(); // Returns rive::ViewModelInstance*
     void* CreateViewModelInstanceById(int viewModelId); // Returns rive::ViewModelInstance*
     void* CreateViewModelInstanceByName(const std::string& viewModelName); // Returns rive::ViewModelInstance*
     bool BindViewModelInstance(void* instance); // Takes rive::ViewModelInstance*
     void* GetBoundViewModelInstance(); // Returns rive::ViewModelInstance*
+    std::shared_ptr<ViewModelInstanceRegistry> GetViewModelInstanceRegistry() const { return m_viewModelInstanceRegistry; }
     
     // Property access on bound instance
     bool SetViewModelStringProperty(const std::string& propertyName, const std::string& value);
@@ -212,9 +523,20 @@ public:
     bool FireViewModelTrigger(const std::string& triggerName);
     
     // Property enumeration and access
+    enum class ViewModelPropertyKind : uint8_t {
+        String, Number, Boolean, Color, Enum, Trigger, List, ViewModel, Unknown
+    };
+
+    // Kind of a view model property, keyed on the runtime's core type. Each
+    // key is classified once and remembered, so after the first schema this
+    // is a table lookup per property.
+    static ViewModelPropertyKind GetViewModelPropertyKind(const void* property); // Takes rive::ViewModelProperty*
+    static const char* GetViewModelPropertyKindName(ViewModelPropertyKind kind);
+
     struct ViewModelPropertyInfo {
         std::string name;
-        std::string type; // "String", "Number", "Boolean", "Color", "Enum", "Trigger"
+        std::string type; // "String", "Number", "Boolean", "Color", "Enum", "Trigger", "List", "ViewModel", "Unknown"
+        ViewModelPropertyKind kind = ViewModelPropertyKind::Unknown;
         int index;
     };
     
@@ -234,7 +556,15 @@ private:
     
     // Rive setup
     void CreateRiveContext();
-    void CreateRiveContent();
+    void CreateRiveContent(const uint8_t* data, size_t size, std::shared_ptr<RivArchive> assetArchive = nullptr, std::string_view entryName = {});
+    void ApplySourceDataPolicy();
+
+    // Hot reload
+    void HotReloadLoop(std::string filePath);
+    void ImportReloadedContent(const std::string& filePath, std::shared_ptr<const std::vector<uint8_t>> data);
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    void ReloadRiveContent(rive::rcp<rive::File> file, std::shared_ptr<const std::vector<uint8_t>> data);
+#endif
     void ClearScene();
     void MakeScene();
     
@@ -252,6 +582,13 @@ private:
     
     // Input processing
     void ProcessInputQueue();
+    void ApplyInputUpdates(const std::vector<InputUpdate>& batch);
+    void CollectNotifications();
+    void SyncViewModelSnapshot(bool report);
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    rive::ViewModelInstanceValue* BoundPropertyOfKind(const std::string& propertyName, ViewModelPropertyKind kind);
+#endif
+    void AdvanceScene();
     void ForwardPointerEventToStateMachine(float x, float y, bool isDown);
     
     // Coordinate transformation
@@ -260,4 +597,13 @@ private:
     
     // State machine initialization
     void EnumerateAndInitializeStateMachines();
+    void RebuildInputIndex();
+    size_t ResidentStateMachineBytes() const;
+    void EvictResidentStateMachines();
+    void PrepareResetSpare();
+    void ClearResidentStateMachines();
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    rive::SMIInput* FindInput(std::string_view name, uint16_t coreType) const;
+    rive::SMIInput* FindInputByHandle(uint64_t handle, uint16_t coreType) const;
+#endif
 };
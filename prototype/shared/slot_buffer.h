@@ -0,0 +1,48 @@
+#pragma once
+
+// Bounded buffer whose slots are filled in place and handed over by swapping
+// vectors, so after the first few rounds filling and taking allocate nothing:
+// a slot keeps what it held last time (a string's capacity, say) and the
+// taker's vector comes back as the next round's slots. Not synchronized - the
+// owner locks around every call.
+
+#include <cstddef>
+#include <vector>
+
+template <typename T>
+class SlotBuffer {
+public:
+    explicit SlotBuffer(size_t capacity) : m_capacity(capacity) {}
+
+    // The next slot to fill, holding whatever it held before. New slots are
+    // only created while the buffers warm up. Null once `capacity` slots are
+    // filled; a taker that falls behind loses the rest.
+    T* Next()
+    {
+        if (m_count >= m_capacity) {
+            return nullptr;
+        }
+        if (m_count == m_slots.size()) {
+            m_slots.emplace_back();
+        }
+        return &m_slots[m_count++];
+    }
+
+    size_t Count() const { return m_count; }
+
+    // Swaps the slots into `taken` and returns how many of them were filled;
+    // entries past that are spares. What `taken` held becomes the slots of
+    // the next round.
+    size_t Take(std::vector<T>& taken)
+    {
+        taken.swap(m_slots);
+        size_t count = m_count;
+        m_count = 0;
+        return count;
+    }
+
+private:
+    std::vector<T> m_slots;
+    size_t m_count = 0;
+    size_t m_capacity;
+};
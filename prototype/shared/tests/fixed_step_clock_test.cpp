@@ -0,0 +1,246 @@
+// FixedStepClock: frame times turned into equal steps with the remainder
+// carried over, the catch-up limit after a hitch, restarts after a pause or
+// seek, and the time scale. Frame times are synthetic, so every run sees the
+// same numbers.
+
+#include "../fixed_step_clock.h"
+
+#include <cstdio>
+#include <limits>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    using TimePoint = FixedStepClock::TimePoint;
+
+    TimePoint At(double seconds)
+    {
+        return TimePoint{} + std::chrono::duration_cast<TimePoint::duration>(std::chrono::duration<double>(seconds));
+    }
+
+    // Ticks at each of `frameTimes` and returns the total steps run
+    int Run(FixedStepClock& clock, const std::vector<double>& frameTimes, float timeScale = 1.0f)
+    {
+        int steps = 0;
+        for (double time : frameTimes) {
+            steps += clock.Tick(At(time), timeScale);
+        }
+        return steps;
+    }
+
+    // `count` frames `interval` apart, starting at `start`
+    std::vector<double> Frames(double start, double interval, int count)
+    {
+        std::vector<double> times;
+        for (int i = 0; i < count; ++i) {
+            times.push_back(start + interval * i);
+        }
+        return times;
+    }
+
+    void TestDisabled()
+    {
+        FixedStepClock clock;
+        Check(!clock.IsEnabled(), "off until configured");
+        Check(clock.Tick(At(1.0), 1.0f) == 0, "no steps while off");
+
+        clock.Configure(-1.0f, 4);
+        Check(!clock.IsEnabled() && clock.StepSeconds() == 0.0f, "negative step turns it off");
+    }
+
+    void TestFirstTickRunsOneStep()
+    {
+        FixedStepClock clock;
+        clock.Configure(1.0f / 120.0f, 4);
+        Check(clock.Tick(At(100.0), 1.0f) == 1, "first tick runs one step whatever the time");
+        Check(clock.Pending() == 0.0, "nothing owed after the first step");
+    }
+
+    void TestStepsPerFrame()
+    {
+        // 64 Hz frames with a 1/128 s step: two steps a frame
+        FixedStepClock clock;
+        clock.Configure(1.0f / 128.0f, 4);
+        clock.Tick(At(0.0), 1.0f);
+        bool even = true;
+        for (int frame = 1; frame <= 64; ++frame) {
+            even = even && clock.Tick(At(frame / 64.0), 1.0f) == 2;
+        }
+        Check(even, "two steps per frame at twice the frame rate");
+
+        // 96 Hz frames with a 1/64 s step: each frame owes two thirds of a
+        // step, so the remainder has to carry over for two steps every three
+        // frames. 97 frames owe 64.67 steps.
+        clock.Configure(1.0f / 64.0f, 4);
+        clock.Tick(At(0.0), 1.0f);
+        int steps = Run(clock, Frames(1.0 / 96.0, 1.0 / 96.0, 97));
+        Check(steps == 64, "remainder carried across frames");
+        Check(clock.Pending() < 1.0 / 64.0, "less than one step left owed");
+    }
+
+    // The same span of time split into different frames runs the same number
+    // of steps, which is what makes replays match across machines
+    void TestFrameRateIndependent()
+    {
+        FixedStepClock smooth;
+        smooth.Configure(1.0f / 128.0f, 8);
+        smooth.Tick(At(0.0), 1.0f);
+        int smoothSteps = Run(smooth, Frames(1.0 / 64.0, 1.0 / 64.0, 64));
+
+        FixedStepClock uneven;
+        uneven.Configure(1.0f / 128.0f, 8);
+        uneven.Tick(At(0.0), 1.0f);
+        std::vector<double> times;
+        for (double time = 0.0; time < 1.0;) {
+            time += (times.size() % 3 == 0) ? 1.0 / 32.0 : 1.0 / 128.0;
+            times.push_back(time < 1.0 ? time : 1.0);
+        }
+        int unevenSteps = Run(uneven, times);
+
+        Check(smoothSteps == 128 && unevenSteps == 128, "steps depend on elapsed time, not frame spacing");
+        Check(smooth.Pending() == uneven.Pending(), "same remainder either way");
+    }
+
+    void TestCatchUpLimit()
+    {
+        FixedStepClock clock;
+        clock.Configure(1.0f / 64.0f, 4);
+        clock.Tick(At(0.0), 1.0f);
+
+        // A one second hitch owes 64 steps; only 4 run and the rest is dropped
+        Check(clock.Tick(At(1.0), 1.0f) == 4, "catch-up capped");
+        Check(clock.Pending() < 1.0 / 64.0, "dropped steps aren't owed later");
+        Check(clock.Tick(At(1.0 + 1.0 / 64.0), 1.0f) == 1, "back to one step a frame after the hitch");
+
+        // Keeps the fraction so the cadence stays even
+        clock.Configure(1.0f / 64.0f, 2);
+        clock.Tick(At(0.0), 1.0f);
+        clock.Tick(At(10.5 / 64.0), 1.0f);
+        Check(clock.Pending() == 0.5 / 64.0, "fraction kept when steps are dropped");
+
+        clock.Configure(1.0f / 64.0f, 0);
+        clock.Tick(At(0.0), 1.0f);
+        Check(clock.Tick(At(1.0), 1.0f) == 1, "catch-up limit is at least one step");
+    }
+
+    void TestRestart()
+    {
+        FixedStepClock clock;
+        clock.Configure(1.0f / 64.0f, 4);
+        clock.Tick(At(0.0), 1.0f);
+        clock.Tick(At(1.0 / 64.0), 1.0f);
+
+        // Paused for a minute - that time isn't owed
+        clock.Restart();
+        Check(clock.Tick(At(61.0), 1.0f) == 1, "one step after a restart");
+        Check(clock.Tick(At(61.0 + 1.0 / 64.0), 1.0f) == 1, "steady again after the restart");
+
+        // Configure starts over with nothing owed
+        clock.Tick(At(61.0 + 1.5 / 64.0), 1.0f);
+        Check(clock.Pending() > 0.0, "fraction owed before reconfiguring");
+        clock.Configure(1.0f / 64.0f, 4);
+        Check(clock.Pending() == 0.0, "configure clears what was owed");
+    }
+
+    void TestTimeScale()
+    {
+        // Same 64 Hz frames and 1/64 s step, one second each
+        auto stepsAt = [](float timeScale) {
+            FixedStepClock clock;
+            clock.Configure(1.0f / 64.0f, 4);
+            clock.Tick(At(0.0), timeScale);
+            return Run(clock, Frames(1.0 / 64.0, 1.0 / 64.0, 64), timeScale);
+        };
+        Check(stepsAt(1.0f) == 64, "normal speed");
+        Check(stepsAt(0.5f) == 32, "slow motion runs half the steps");
+        Check(stepsAt(2.0f) == 128, "fast forward runs twice the steps");
+        Check(stepsAt(8.0f) == 4 * 64, "fast forward is bounded by the catch-up limit");
+
+        // The step length never changes with the scale
+        FixedStepClock clock;
+        clock.Configure(1.0f / 64.0f, 4);
+        clock.Tick(At(0.0), 0.25f);
+        Check(clock.StepSeconds() == 1.0f / 64.0f, "scale stretches time, not the step");
+    }
+
+    void TestFreeze()
+    {
+        FixedStepClock clock;
+        clock.Configure(1.0f / 64.0f, 4);
+        clock.Tick(At(0.0), 1.0f);
+        clock.Tick(At(0.5 / 64.0), 1.0f);
+
+        // Frozen for ten seconds of frames: no steps, and the fraction owed
+        // before the freeze is still owed after it
+        int frozen = Run(clock, Frames(1.0 / 64.0, 1.0 / 64.0, 640), 0.0f);
+        Check(frozen == 0, "scale 0 runs no steps");
+        Check(clock.Pending() == 0.5 / 64.0, "freezing keeps what was owed");
+
+        // The frozen frames kept the clock moving, so resuming owes one frame
+        Check(clock.Tick(At(641.0 / 64.0), 1.0f) == 1, "resuming doesn't owe the frozen time");
+        Check(clock.Pending() == 0.5 / 64.0, "fraction still carried after resuming");
+    }
+
+    // A bad scale counts as a freeze instead of leaving the accumulator NaN
+    // and the simulation stuck after the scale is fixed
+    void TestBadScale()
+    {
+        const float bad[] = { -1.0f, std::numeric_limits<float>::quiet_NaN(), std::numeric_limits<float>::infinity() };
+        for (float timeScale : bad) {
+            FixedStepClock clock;
+            clock.Configure(1.0f / 64.0f, 4);
+            clock.Tick(At(0.0), 1.0f);
+            int steps = Run(clock, Frames(1.0 / 64.0, 1.0 / 64.0, 4), timeScale);
+            steps += Run(clock, Frames(5.0 / 64.0, 1.0 / 64.0, 4), 1.0f);
+            if (steps != 4 || clock.Pending() != 0.0) {
+                std::printf("FAILED: scale %f ran %d steps afterwards\n", timeScale, steps);
+                ++g_failures;
+            }
+        }
+    }
+
+    // SeekAnimation restarts the clock: the seek jumps the time itself, so the
+    // frame after it runs one step rather than catching up on the seek's cost
+    void TestSeekRestart()
+    {
+        FixedStepClock clock;
+        clock.Configure(1.0f / 64.0f, 8);
+        clock.Tick(At(0.0), 1.0f);
+        clock.Tick(At(1.0 / 64.0), 1.0f);
+
+        clock.Restart();
+        Check(clock.Tick(At(6.0 / 64.0), 1.0f) == 1, "one step on the frame after a seek");
+        Check(clock.Tick(At(7.0 / 64.0), 1.0f) == 1, "steady after the seek");
+
+        clock.Restart();
+        Check(clock.Tick(At(8.0 / 64.0), 0.0f) == 0, "a seek while frozen stays frozen");
+    }
+}
+
+int main()
+{
+    TestDisabled();
+    TestFirstTickRunsOneStep();
+    TestStepsPerFrame();
+    TestFrameRateIndependent();
+    TestCatchUpLimit();
+    TestRestart();
+    TestTimeScale();
+    TestFreeze();
+    TestBadScale();
+    TestSeekRestart();
+
+    if (g_failures == 0) {
+        std::printf("fixed_step_clock_test: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,86 @@
+// State machine input lookup by name: the linear scan the setters used to do
+// against the name index RiveRenderer now builds on activation (see
+// RebuildInputIndex). Inputs are modelled by name and slot only, since the
+// Rive runtime isn't available here.
+//
+//   ./input_lookup_benchmark [lookups]
+
+#include "../transparent_string_hash.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    // Names sharing a long prefix, as exported inputs often do, so the scan
+    // pays for real comparisons rather than failing on the first byte
+    std::vector<std::string> MakeNames(size_t count)
+    {
+        std::vector<std::string> names;
+        for (size_t i = 0; i < count; ++i) {
+            names.push_back("buttonHoverProgress_" + std::to_string(i));
+        }
+        return names;
+    }
+
+    template <typename Lookup>
+    double NanosecondsPerLookup(const std::vector<std::string>& keys, size_t lookups, Lookup lookup)
+    {
+        for (size_t slot = 0; slot < keys.size(); ++slot) {
+            if (lookup(keys[slot]) != slot) {
+                std::printf("lookup returned the wrong slot\n");
+                std::exit(1);
+            }
+        }
+
+        volatile size_t sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < lookups; ++i) {
+            sink = sink + lookup(keys[i % keys.size()]);
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        return seconds * 1e9 / lookups;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t lookups = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 2000000;
+
+    std::printf("%8s %14s %14s %8s\n", "inputs", "scan ns", "index ns", "speedup");
+    for (size_t count : { 4, 16, 64, 256 }) {
+        auto names = MakeNames(count);
+
+        // Before: a std::string built from the caller's name, then compared
+        // against every input in order
+        double scan = NanosecondsPerLookup(names, lookups, [&](const std::string& key) -> size_t {
+            std::string name(key.data(), key.size());
+            for (size_t slot = 0; slot < names.size(); ++slot) {
+                if (names[slot] == name) {
+                    return slot;
+                }
+            }
+            return 0;
+        });
+
+        // After: a string_view into a reused buffer, looked up in the index
+        std::unordered_map<std::string, uint32_t, TransparentStringHash, std::equal_to<>> index;
+        index.reserve(count);
+        for (size_t slot = 0; slot < names.size(); ++slot) {
+            index.try_emplace(names[slot], static_cast<uint32_t>(slot));
+        }
+        std::string buffer;
+        double indexed = NanosecondsPerLookup(names, lookups, [&](const std::string& key) -> size_t {
+            buffer.assign(key.data(), key.size());
+            auto it = index.find(std::string_view(buffer));
+            return it == index.end() ? 0 : it->second;
+        });
+
+        std::printf("%8zu %14.1f %14.1f %7.1fx\n", count, scan, indexed, scan / indexed);
+    }
+    return 0;
+}
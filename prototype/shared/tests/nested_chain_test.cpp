@@ -0,0 +1,199 @@
+// NestingEpoch and NestedChain, as the view model instance wrapper uses
+// them for nested instances: replacing a nested instance makes paths
+// compiled through it resolve again and drops old path handles with the
+// generation, a re-pointed level rejects the writes of every wrapper below
+// it, and the flag the render thread sets is seen by the UI thread. A fake
+// tree of properties stands in for the Rive runtime.
+
+#include "../nested_chain.h"
+#include "../property_handles.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    // A view model property and the instance it refers to. Atomic only so
+    // the threaded case can re-point it from the test's "file".
+    struct Instance {
+        int value = 0;
+    };
+    struct Property {
+        std::atomic<Instance*> instance{ nullptr };
+    };
+
+    // Shaped like the wrapper's NestedLink
+    struct Link {
+        const Property* property;
+        const Instance* instance;
+        bool IsCurrent() const { return property->instance.load() == instance; }
+    };
+    using Chain = NestedChain<Link>;
+
+    // A write posted through `chain`, applied only if the chain is current
+    bool Write(const Chain& chain, Instance& target, int value)
+    {
+        if (!chain.Current()) {
+            return false;
+        }
+        target.value = value;
+        return true;
+    }
+
+    // Shaped like the wrapper's CompiledPath: what a path handle resolved to
+    struct CompiledPath {
+        uint32_t epoch = 0;
+        Instance* leaf = nullptr;
+        Chain leafChain;
+    };
+
+    // Walks root.child; the leaf is whatever the property holds now
+    CompiledPath Resolve(const NestingEpoch& epoch, Property& child)
+    {
+        CompiledPath compiled;
+        compiled.epoch = epoch.Value();
+        compiled.leaf = child.instance.load();
+        compiled.leafChain = Chain().Extend({ &child, compiled.leaf });
+        return compiled;
+    }
+
+    // ReplaceNested: the wrapper posts the new instance and moves the epoch
+    // shared by its tree
+    void TestReplaceInvalidatesPaths()
+    {
+        Instance first;
+        Instance second;
+        Property child;
+        child.instance = &first;
+
+        NestingEpoch rootEpoch;
+        NestingEpoch childEpoch = rootEpoch;   // Handed to the nested wrapper
+        PropertyHandles handles;
+        handles.NewGeneration();
+
+        std::vector<CompiledPath> paths;
+        paths.push_back(Resolve(rootEpoch, child));
+        uint64_t handle = handles.ForPath(0);
+        Check(rootEpoch.IsCurrent(paths[0].epoch), "fresh path is current");
+
+        // Replaced through the nested wrapper; the root sees it too
+        child.instance = &second;
+        childEpoch.Advance();
+        int index = handles.PathOf(handle, paths.size());
+        Check(index == 0, "path handle still names its path");
+        Check(!rootEpoch.IsCurrent(paths[index].epoch), "replacement makes the path resolve again");
+
+        // A write through the stale resolution is rejected; resolving again
+        // reaches the new instance
+        Check(!Write(paths[index].leafChain, *paths[index].leaf, 1) && first.value == 0,
+            "write through the old resolution rejected");
+        paths[index] = Resolve(rootEpoch, child);
+        Check(paths[index].leaf == &second && Write(paths[index].leafChain, *paths[index].leaf, 2) && second.value == 2,
+            "resolved again to the replacement");
+
+        // InvalidatePropertyCache: the table goes with a new generation, so
+        // the old handle doesn't name a path in the next table
+        handles.NewGeneration();
+        rootEpoch.Advance();
+        paths.clear();
+        paths.push_back(Resolve(rootEpoch, child));
+        Check(handles.PathOf(handle, paths.size()) == -1, "old path handle rejected after re-pointing the root");
+        Check(handles.PathOf(handles.ForPath(0), paths.size()) == 0, "new path handle works");
+    }
+
+    // root.child.grandchild with the file re-pointing root.child: the child
+    // and grandchild wrappers both go detached, siblings don't
+    void TestDetachedChildWritesRejected()
+    {
+        Instance child;
+        Instance otherChild;
+        Instance grandchild;
+        Instance sibling;
+        Property childProperty;
+        Property grandchildProperty;
+        Property siblingProperty;
+        childProperty.instance = &child;
+        grandchildProperty.instance = &grandchild;
+        siblingProperty.instance = &sibling;
+
+        Chain root;
+        Chain childChain = root.Extend({ &childProperty, &child });
+        Chain grandchildChain = childChain.Extend({ &grandchildProperty, &grandchild });
+        Chain siblingChain = root.Extend({ &siblingProperty, &sibling });
+
+        Check(root.Current() && !root.IsDetached(true), "the root's empty chain is always current");
+        Check(Write(grandchildChain, grandchild, 1) && grandchild.value == 1, "writes apply while attached");
+
+        childProperty.instance = &otherChild;
+        Check(!Write(childChain, child, 2) && child.value == 0, "detached child's write rejected");
+        Check(!Write(grandchildChain, grandchild, 3) && grandchild.value == 1, "writes below a detached level rejected");
+        Check(Write(siblingChain, sibling, 4) && sibling.value == 4, "sibling keeps writing");
+
+        // The flag is on the child's level: the child wrapper is replaced,
+        // the grandchild only knows something above it moved
+        Check(childChain.IsDetached(false), "child wrapper detached");
+        Check(!grandchildChain.IsDetached(false) && grandchildChain.IsDetached(true), "grandchild detached above");
+        Check(!siblingChain.IsDetached(true), "sibling not detached");
+
+        // Pointing back doesn't revive the old wrappers - the UI thread may
+        // already have made new ones
+        childProperty.instance = &child;
+        Check(!Write(childChain, child, 5) && child.value == 0, "detached stays detached");
+
+        // A new wrapper for what the property holds gets a fresh chain
+        Chain rewrapped = root.Extend({ &childProperty, &child });
+        Check(Write(rewrapped, child, 6) && child.value == 6, "new wrapper writes");
+    }
+
+    // Current() runs on the render thread, IsDetached() on the UI thread
+    void TestFlagCrossesThreads()
+    {
+        Instance first;
+        Instance second;
+        Property child;
+        child.instance = &first;
+        Chain chain = Chain().Extend({ &child, &first });
+        Chain posted = chain;   // The copy a posted write captures
+
+        std::atomic<bool> stop{ false };
+        std::thread renderThread([&]() {
+            while (!stop.load()) {
+                posted.Current();
+            }
+        });
+
+        // The file re-points it while writes keep coming; the UI thread polls
+        child.instance = &second;
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+        while (!chain.IsDetached(false) && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::yield();
+        }
+        stop = true;
+        renderThread.join();
+        Check(chain.IsDetached(false), "UI thread sees the render thread's flag");
+    }
+}
+
+int main()
+{
+    TestReplaceInvalidatesPaths();
+    TestDetachedChildWritesRejected();
+    TestFlagCrossesThreads();
+
+    if (g_failures == 0) {
+        std::printf("nested_chain_test: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
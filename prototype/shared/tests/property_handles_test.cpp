@@ -0,0 +1,106 @@
+// PropertyHandles, as the view model instance wrapper uses them: slot and
+// path handles round trip, a new generation (InvalidatePropertyCache)
+// rejects every handle taken before it, a handle from one wrapper is
+// rejected by another, and handles outside the table or of the other kind
+// don't resolve.
+
+#include "../property_handles.h"
+
+#include <cstdio>
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    // A wrapper just given its native instance
+    PropertyHandles Bound()
+    {
+        PropertyHandles handles;
+        handles.NewGeneration();
+        return handles;
+    }
+
+    void TestRoundTrip()
+    {
+        auto handles = Bound();
+        uint64_t slot = handles.ForSlot(3);
+        uint64_t path = handles.ForPath(5);
+        Check(slot != PropertyHandles::kInvalid && path != PropertyHandles::kInvalid, "handles are never 0");
+        Check(handles.SlotOf(slot, 8) == 3, "slot handle resolves to its slot");
+        Check(handles.PathOf(path, 8) == 5, "path handle resolves to its path");
+        Check(!PropertyHandles::IsPath(slot) && PropertyHandles::IsPath(path), "path flag tells them apart");
+        Check(handles.SlotOf(handles.ForSlot(0), 1) == 0, "slot 0 is a valid handle");
+        Check(handles.ForSlot(-1) == PropertyHandles::kInvalid, "no handle for a missing slot");
+    }
+
+    // InvalidatePropertyCache takes a new generation: handles from before
+    // fail even though the slot still exists, and handles taken after work
+    void TestNewGenerationRejectsOldHandles()
+    {
+        auto handles = Bound();
+        uint64_t oldSlot = handles.ForSlot(2);
+        uint64_t oldPath = handles.ForPath(0);
+        uint32_t oldGeneration = handles.Generation();
+
+        handles.NewGeneration();
+        Check(handles.Generation() != oldGeneration, "generation moved");
+        Check(handles.SlotOf(oldSlot, 8) == -1, "old slot handle rejected");
+        Check(handles.PathOf(oldPath, 8) == -1, "old path handle rejected");
+
+        uint64_t newSlot = handles.ForSlot(2);
+        Check(newSlot != oldSlot && handles.SlotOf(newSlot, 8) == 2, "new handle for the same slot works");
+
+        // Many re-points later the first handle is still rejected
+        for (int i = 0; i < 1000; ++i) {
+            handles.NewGeneration();
+        }
+        Check(handles.SlotOf(oldSlot, 8) == -1, "old handle stays rejected");
+    }
+
+    // Generations are process-wide, so one wrapper's handle means nothing to
+    // another, even for the same slot
+    void TestOtherWrapperRejects()
+    {
+        auto first = Bound();
+        auto second = Bound();
+        Check(first.Generation() != second.Generation(), "each wrapper has its own generation");
+        Check(second.SlotOf(first.ForSlot(1), 8) == -1, "other wrapper's slot handle rejected");
+        Check(second.PathOf(first.ForPath(1), 8) == -1, "other wrapper's path handle rejected");
+    }
+
+    void TestBounds()
+    {
+        auto handles = Bound();
+        Check(handles.SlotOf(handles.ForSlot(4), 4) == -1, "slot past the schema rejected");
+        Check(handles.PathOf(handles.ForPath(4), 4) == -1, "path past the table rejected");
+        Check(handles.SlotOf(handles.ForPath(1), 8) == -1, "path handle isn't a slot");
+        Check(handles.PathOf(handles.ForSlot(1), 8) == -1, "slot handle isn't a path");
+        Check(handles.SlotOf(PropertyHandles::kInvalid, 8) == -1, "invalid handle rejected");
+        Check(handles.ForPath(PropertyHandles::kMaxPaths) == PropertyHandles::kInvalid, "no handle past the path limit");
+
+        // A wrapper that never had an instance only takes generation 0
+        // handles, and those can't name a slot without a schema
+        PropertyHandles unbound;
+        Check(unbound.SlotOf(PropertyHandles::kInvalid, 0) == -1, "unbound wrapper resolves nothing");
+    }
+}
+
+int main()
+{
+    TestRoundTrip();
+    TestNewGenerationRejectsOldHandles();
+    TestOtherWrapperRejects();
+    TestBounds();
+
+    if (g_failures == 0) {
+        std::printf("property_handles_test: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
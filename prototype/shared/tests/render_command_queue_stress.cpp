@@ -0,0 +1,163 @@
+// RenderCommandQueue under contention: producers posting while a consumer
+// drains, switching between a render thread and inline drains, and closing
+// with posts in flight. Build it with -fsanitize=thread too (make tsan).
+
+#include "../render_command_queue.h"
+
+#include <atomic>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    // Captured by every command; counts how many closures were created and
+    // destroyed, so a node dropped without being freed shows up as a leak
+    struct Token {
+        explicit Token(std::atomic<long>& live) : m_live(live) { ++m_live; }
+        ~Token() { --m_live; }
+        std::atomic<long>& m_live;
+    };
+
+    constexpr int kProducers = 4;
+    constexpr long kPostsPerProducer = 20000;
+
+    // Producers post in order while a render thread drains; each producer's
+    // commands must run exactly once and in the order they were posted
+    void RenderThreadRound()
+    {
+        RenderCommandQueue queue;
+        std::mutex device;
+        std::atomic<long> live{ 0 };
+        std::vector<long> lastSeen(kProducers, -1);
+        long executed = 0;   // Only touched by commands, which are serialized
+        bool ordered = true;                  // Commands only
+        std::atomic<bool> completed{ true };  // Producers
+
+        queue.SetInlineDrain([&] { std::lock_guard<std::mutex> lock(device); queue.Drain(); });
+        queue.SetConsumerRunning(true);
+        std::atomic<bool> running{ true };
+        std::thread consumer([&] {
+            while (running) {
+                std::lock_guard<std::mutex> lock(device);
+                queue.Drain();
+            }
+        });
+
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&, p] {
+                for (long i = 0; i < kPostsPerProducer; ++i) {
+                    queue.Post([&, p, i, token = std::make_shared<Token>(live)] {
+                        ordered &= lastSeen[p] == i - 1;
+                        lastSeen[p] = i;
+                        ++executed;
+                    });
+                    if (i % 2000 == 0) {
+                        if (!queue.PostWithCompletion([] { return true; })->Wait()) {
+                            completed = false;
+                        }
+                    }
+                }
+            });
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        // Hand over to inline drains, as when the render thread stops
+        running = false;
+        consumer.join();
+        queue.SetConsumerRunning(false);
+        queue.Post([&] { ++executed; queue.Post([&] { ++executed; }); });
+        {
+            std::lock_guard<std::mutex> lock(device);
+            queue.Drain();
+        }
+
+        Check(ordered, "commands run in posting order per producer");
+        Check(completed, "completions resolve with the command's result");
+        Check(executed == kProducers * kPostsPerProducer + 2, "every command runs exactly once");
+        Check(queue.IsEmpty(), "queue is empty after the final drain");
+        Check(live == 0, "every command closure is freed");
+    }
+
+    // Close() while producers are still posting: nothing may be pushed after
+    // the close, every node must be freed and every completion must resolve
+    void CloseRound()
+    {
+        auto queue = std::make_unique<RenderCommandQueue>();
+        std::mutex device;
+        std::atomic<long> live{ 0 };
+        std::atomic<long> unresolved{ 0 };
+        std::atomic<long> executed{ 0 };
+
+        queue->SetConsumerRunning(true);
+        std::atomic<bool> running{ true };
+        std::thread consumer([&] {
+            while (running) {
+                std::lock_guard<std::mutex> lock(device);
+                queue->Drain();
+            }
+        });
+
+        std::atomic<bool> go{ false };
+        std::vector<std::thread> producers;
+        for (int p = 0; p < kProducers; ++p) {
+            producers.emplace_back([&] {
+                while (!go) {
+                }
+                for (long i = 0; i < kPostsPerProducer / 4; ++i) {
+                    queue->Post([&, token = std::make_shared<Token>(live)] { ++executed; });
+                    auto completion = queue->PostWithCompletion([&, token = std::make_shared<Token>(live)] { return true; });
+                    if (!completion->WaitFor(std::chrono::seconds(10))) {
+                        ++unresolved;
+                    }
+                }
+            });
+        }
+
+        go = true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+
+        // Owner shutdown order: stop the render thread, then close
+        running = false;
+        consumer.join();
+        queue->SetConsumerRunning(false);
+        {
+            std::lock_guard<std::mutex> lock(device);
+            queue->Close();
+        }
+        for (auto& producer : producers) {
+            producer.join();
+        }
+
+        Check(unresolved == 0, "every completion resolves across Close()");
+        Check(queue->IsEmpty(), "nothing is queued after Close()");
+        Check(live == 0, "no command closure leaks across Close()");
+        queue.reset();
+    }
+}
+
+int main()
+{
+    for (int round = 0; round < 3; ++round) {
+        RenderThreadRound();
+        CloseRound();
+    }
+    if (g_failures == 0) {
+        std::printf("render_command_queue_stress: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
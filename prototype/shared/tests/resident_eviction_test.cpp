@@ -0,0 +1,156 @@
+// Resident state machine eviction: reset spares go before instances, then
+// the least recently used instance, never the active one, until the set fits
+// the byte cap.
+
+#include "../resident_eviction.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    // RiveRenderer's default capacity (kDefaultStateMachineCacheCapacity)
+    constexpr size_t kDefaultCapacity = 256 * 1024;
+
+    struct Instance {
+        size_t bytes;
+    };
+
+    struct Slot {
+        std::unique_ptr<Instance> instance;
+        uint64_t lastUsed = 0;
+        std::unique_ptr<Instance> resetSpare;
+        int evictions = 0;
+    };
+
+    size_t BytesOf(const Instance* instance)
+    {
+        return instance->bytes;
+    }
+
+    // One resident instance of `bytes` per entry of `lastUsed`
+    std::vector<Slot> MakeSlots(size_t bytes, const std::vector<uint64_t>& lastUsed)
+    {
+        std::vector<Slot> slots(lastUsed.size());
+        for (size_t i = 0; i < slots.size(); ++i) {
+            slots[i].instance = std::make_unique<Instance>(Instance{ bytes });
+            slots[i].lastUsed = lastUsed[i];
+        }
+        return slots;
+    }
+
+    size_t Evict(std::vector<Slot>& slots, const Instance* active, size_t capacity)
+    {
+        return EvictLeastRecentlyUsed(slots, active, capacity, BytesOf, [](Slot& slot) { ++slot.evictions; });
+    }
+
+    void TestUnderCapKeepsEverything()
+    {
+        auto slots = MakeSlots(64 * 1024, { 1, 2, 3, 4 });
+        size_t left = Evict(slots, slots[0].instance.get(), kDefaultCapacity);
+        Check(left == kDefaultCapacity, "a set exactly at the cap stays");
+        for (const auto& slot : slots) {
+            Check(slot.instance && slot.evictions == 0, "nothing evicted at the cap");
+        }
+    }
+
+    void TestOldestGoesFirst()
+    {
+        // Used in the order 4, 2, 0, 3, 1, 5; slot 1 is active
+        auto slots = MakeSlots(64 * 1024, { 20, 40, 10, 30, 5, 50 });
+        // 6 x 64 KB against 256 KB: the two oldest, slots 4 and 2, go
+        size_t left = Evict(slots, slots[1].instance.get(), kDefaultCapacity);
+        Check(left == kDefaultCapacity, "evicted down to the cap");
+        Check(!slots[4].instance && slots[4].evictions == 1, "least recently used evicted");
+        Check(!slots[2].instance && slots[2].evictions == 1, "second least recently used evicted");
+        Check(slots[0].instance && slots[1].instance && slots[3].instance && slots[5].instance,
+              "more recently used instances stay");
+    }
+
+    void TestActiveIsNeverEvicted()
+    {
+        // The active instance is the oldest and alone outgrows the cap
+        auto slots = MakeSlots(16 * 1024, { 1, 2 });
+        slots[0].instance->bytes = 300 * 1024;
+        size_t left = Evict(slots, slots[0].instance.get(), kDefaultCapacity);
+        Check(slots[0].instance != nullptr, "active instance kept over the cap");
+        Check(!slots[1].instance, "everything else evicted");
+        Check(left == 300 * 1024, "only the active instance left");
+    }
+
+    void TestSparesGoFirst()
+    {
+        // Slot 0 is the oldest; its spare and slot 2's must go before it
+        auto slots = MakeSlots(96 * 1024, { 1, 3, 2 });
+        slots[0].resetSpare = std::make_unique<Instance>(Instance{ 32 * 1024 });
+        slots[2].resetSpare = std::make_unique<Instance>(Instance{ 32 * 1024 });
+        Check(SumResidentBytes(slots, BytesOf) == 352 * 1024, "spares count against the cap");
+
+        // 352 KB against 320 KB: one spare is enough
+        size_t left = Evict(slots, slots[1].instance.get(), 320 * 1024);
+        Check(left == 320 * 1024, "one spare dropped");
+        Check(!slots[0].resetSpare && slots[2].resetSpare, "spares dropped in slot order, only as needed");
+        Check(slots[0].instance && slots[0].evictions == 0, "no instance evicted while a spare could go");
+
+        // 320 KB against 200 KB: the other spare, then the oldest instance
+        left = Evict(slots, slots[1].instance.get(), 200 * 1024);
+        Check(!slots[2].resetSpare, "remaining spare dropped");
+        Check(!slots[0].instance && slots[0].evictions == 1, "then the least recently used instance");
+        Check(slots[1].instance && slots[2].instance, "newer instances stay");
+        Check(left == 192 * 1024, "bytes left after spares and one instance");
+    }
+
+    // Switching between machines as SetActiveStateMachine does: touch, then
+    // evict with the touched one active
+    void TestSwitchingKeepsRecentlyUsed()
+    {
+        const size_t count = 8;
+        std::vector<Slot> slots(count);
+        uint64_t useCounter = 0;
+        auto activate = [&](size_t index) {
+            if (!slots[index].instance) {
+                slots[index].instance = std::make_unique<Instance>(Instance{ 64 * 1024 });
+            }
+            slots[index].lastUsed = ++useCounter;
+            Evict(slots, slots[index].instance.get(), kDefaultCapacity);
+        };
+
+        for (size_t index : { 0, 1, 2, 3, 4, 1, 5, 6 }) {
+            activate(index);
+        }
+        // Four fit; the last four distinct machines used are 4, 1, 5, 6
+        Check(SumResidentBytes(slots, BytesOf) == kDefaultCapacity, "resident set at the cap");
+        for (size_t index = 0; index < count; ++index) {
+            bool expected = index == 1 || index == 4 || index == 5 || index == 6;
+            if (static_cast<bool>(slots[index].instance) != expected) {
+                std::printf("FAILED: slot %zu resident is %d\n", index, static_cast<int>(!expected));
+                ++g_failures;
+            }
+        }
+    }
+}
+
+int main()
+{
+    TestUnderCapKeepsEverything();
+    TestOldestGoesFirst();
+    TestActiveIsNeverEvicted();
+    TestSparesGoFirst();
+    TestSwitchingKeepsRecentlyUsed();
+
+    if (g_failures == 0) {
+        std::printf("resident_eviction_test: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
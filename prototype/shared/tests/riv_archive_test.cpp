@@ -0,0 +1,144 @@
+// RivArchive lookups and index validation against hand-built archives,
+// including offsets chosen to wrap 64-bit sums.
+
+#include "../riv_archive.h"
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    struct Archive {
+        RivArchiveHeader header{};
+        std::vector<RivArchiveEntry> entries;
+        std::vector<uint32_t> buckets;
+        std::string names;
+        std::vector<uint8_t> payload;
+    };
+
+    // Two entries: a Rive file and an asset next to it
+    Archive MakeArchive()
+    {
+        Archive archive;
+        const std::string names[] = { "buttons/toggle.riv", "buttons/icon-12.png" };
+        const uint32_t flags[] = { RivArchiveEntryRive, RivArchiveEntryAsset };
+
+        archive.buckets.assign(4, 0);
+        for (uint32_t i = 0; i < 2; ++i) {
+            RivArchiveEntry entry{};
+            entry.nameHash = RivArchiveHashName(names[i]);
+            entry.nameOffset = static_cast<uint32_t>(archive.names.size());
+            entry.nameLength = static_cast<uint32_t>(names[i].size());
+            entry.dataSize = 8;
+            entry.flags = flags[i];
+            archive.names += names[i];
+            archive.entries.push_back(entry);
+
+            for (uint32_t probe = 0;; ++probe) {
+                auto& bucket = archive.buckets[(entry.nameHash + probe) & 3];
+                if (bucket == 0) {
+                    bucket = i + 1;
+                    break;
+                }
+            }
+        }
+
+        std::memcpy(archive.header.magic, kRivArchiveMagic, sizeof(kRivArchiveMagic));
+        archive.header.version = kRivArchiveVersion;
+        archive.header.entryCount = 2;
+        archive.header.bucketCount = 4;
+        archive.header.alignment = 1;
+        archive.header.tocOffset = sizeof(RivArchiveHeader);
+        archive.header.bucketOffset = archive.header.tocOffset + 2 * sizeof(RivArchiveEntry);
+        archive.header.namesOffset = archive.header.bucketOffset + 4 * sizeof(uint32_t);
+        archive.header.namesSize = archive.names.size();
+
+        uint64_t dataOffset = archive.header.namesOffset + archive.header.namesSize;
+        for (auto& entry : archive.entries) {
+            entry.dataOffset = dataOffset;
+            dataOffset += entry.dataSize;
+            archive.payload.insert(archive.payload.end(), 8, static_cast<uint8_t>(entry.flags));
+        }
+        return archive;
+    }
+
+    std::shared_ptr<RivArchive> Write(const Archive& archive, const std::string& path, std::string* error)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&archive.header), sizeof(archive.header));
+        file.write(reinterpret_cast<const char*>(archive.entries.data()), archive.entries.size() * sizeof(RivArchiveEntry));
+        file.write(reinterpret_cast<const char*>(archive.buckets.data()), archive.buckets.size() * sizeof(uint32_t));
+        file.write(archive.names.data(), archive.names.size());
+        file.write(reinterpret_cast<const char*>(archive.payload.data()), archive.payload.size());
+        file.close();
+
+        auto opened = RivArchive::Open(path, error);
+        std::remove(path.c_str());
+        return opened;
+    }
+
+    // Open() caches mappings by path, so every variant gets its own name
+    std::shared_ptr<RivArchive> WriteVariant(const Archive& archive, const char* name)
+    {
+        std::string error;
+        return Write(archive, std::string("riv_archive_test_") + name + ".rivpack", &error);
+    }
+}
+
+int main()
+{
+    {
+        auto archive = WriteVariant(MakeArchive(), "valid");
+        Check(archive != nullptr, "valid archive opens");
+        RivArchive::Entry entry;
+        Check(archive && archive->Find("buttons/icon-12.png", entry) && entry.size == 8 &&
+            (entry.flags & RivArchiveEntryAsset) && entry.data[0] == RivArchiveEntryAsset, "asset entry is found");
+        Check(archive && !archive->Find("icon-12.png", entry), "names are not matched by suffix");
+    }
+
+    const uint64_t wrap = ~uint64_t(0) - 15;
+    {
+        auto archive = MakeArchive();
+        archive.header.tocOffset = wrap;
+        Check(!WriteVariant(archive, "toc"), "toc offset that wraps is rejected");
+    }
+    {
+        auto archive = MakeArchive();
+        archive.header.bucketOffset = wrap;
+        Check(!WriteVariant(archive, "buckets"), "bucket offset that wraps is rejected");
+    }
+    {
+        auto archive = MakeArchive();
+        archive.header.namesOffset = 8;
+        archive.header.namesSize = wrap;
+        Check(!WriteVariant(archive, "names"), "names size that wraps is rejected");
+    }
+    {
+        auto archive = MakeArchive();
+        archive.entries[1].nameOffset = 4;
+        archive.entries[1].nameLength = ~uint32_t(0);
+        Check(!WriteVariant(archive, "name"), "entry name past the names block is rejected");
+    }
+    {
+        auto archive = MakeArchive();
+        archive.entries[1].dataSize = wrap;
+        Check(!WriteVariant(archive, "data"), "entry size that wraps is rejected");
+    }
+
+    if (g_failures == 0) {
+        std::printf("riv_archive_test: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
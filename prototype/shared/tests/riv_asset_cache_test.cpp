@@ -0,0 +1,95 @@
+// RiveAssetCache prefetching: hits share the cached bytes without evicting
+// them, and Shutdown() leaves no worker behind.
+
+#include "../riv_asset_cache.h"
+
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    std::string WriteRiv(int index, size_t size)
+    {
+        std::string path = "riv_asset_cache_test_" + std::to_string(index) + ".riv";
+        std::vector<char> bytes(size, static_cast<char>(index));
+        bytes[0] = 'R'; bytes[1] = 'I'; bytes[2] = 'V'; bytes[3] = 'E';
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+        return path;
+    }
+
+    // Get() on a file that is still queued is a miss by design
+    void WaitForPrefetch(RiveAssetCache& cache)
+    {
+        while (cache.GetStatistics().pending != 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+int main()
+{
+    auto& cache = RiveAssetCache::Instance();
+    std::vector<std::string> paths;
+    for (int i = 0; i < 8; ++i) {
+        paths.push_back(WriteRiv(i, 4096 + i));
+    }
+
+    cache.SetMaxConcurrency(3);
+    cache.Prefetch(paths);
+    WaitForPrefetch(cache);
+    std::vector<std::shared_ptr<const std::vector<uint8_t>>> handedOut;
+    for (int i = 0; i < 8; ++i) {
+        auto first = cache.Get(paths[i]);
+        handedOut.push_back(first);
+        auto second = cache.Get(paths[i]);
+        Check(first && first->size() == size_t(4096 + i), "prefetched bytes are returned");
+        Check(first && first == second, "a hit leaves the bytes cached and shared");
+        Check(cache.Holds(paths[i], first.get()), "the cache holds the bytes it handed out");
+    }
+    Check(!cache.Holds(paths[0], nullptr), "the cache doesn't hold other buffers");
+    Check(!cache.Holds("missing.riv", nullptr), "the cache doesn't hold uncached paths");
+
+    auto statistics = cache.GetStatistics();
+    Check(statistics.hits == 16 && statistics.misses == 0, "every Get after Prefetch is a hit");
+    Check(statistics.cachedFiles == 8 && statistics.pending == 0, "all files stay cached");
+
+    // Least recently used goes first: touch 0, then shrink to fit seven files
+    cache.Get(paths[0]);
+    cache.SetCapacity(7 * 4096 + 28);
+    Check(cache.GetStatistics().cachedFiles == 7, "capacity evicts one file");
+    Check(cache.Get(paths[0]) != nullptr, "recently used file survives eviction");
+    Check(cache.Get(paths[1]) == nullptr, "least recently used file is evicted");
+    Check(!cache.Holds(paths[1], handedOut[1].get()), "an evicted file is no longer held");
+
+    // Shutdown waits out in-flight reads; prefetching works again afterwards
+    cache.Clear();
+    cache.SetCapacity(1 << 20);
+    cache.Prefetch(paths);
+    cache.Shutdown();
+    Check(cache.GetStatistics().pending == 0, "nothing pending after Shutdown");
+    cache.Prefetch({ paths[5] });
+    WaitForPrefetch(cache);
+    Check(cache.Get(paths[5]) != nullptr, "Prefetch after Shutdown still works");
+    cache.Shutdown();
+
+    for (const auto& path : paths) {
+        std::remove(path.c_str());
+    }
+    if (g_failures == 0) {
+        std::printf("riv_asset_cache_test: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
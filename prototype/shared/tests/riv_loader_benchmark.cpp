@@ -0,0 +1,190 @@
+// Throughput of RiveSourceLoader for raw and gzip .riv sources, from disk and
+// from memory, against reading the same bytes in place from a mapped
+// RivArchive. Builds on Linux against the system zlib - see README.md.
+//
+//   ./riv_loader_benchmark [megabytes] [iterations]
+
+#include "../riv_archive.h"
+#include "../riv_loader.h"
+
+#include <zlib.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+    // Stand-in for a .riv: a RIVE header followed by records with runs of
+    // repeated values, compressing roughly like real files (3-5x)
+    std::vector<uint8_t> MakePayload(size_t size)
+    {
+        std::vector<uint8_t> payload(size);
+        std::memcpy(payload.data(), "RIVE", 4);
+        uint32_t state = 0x12345678;
+        for (size_t i = 4; i < size; ++i) {
+            state = state * 1664525 + 1013904223;
+            payload[i] = (state >> 24) < 16 ? static_cast<uint8_t>(state >> 16) : static_cast<uint8_t>(i / 64);
+        }
+        return payload;
+    }
+
+    std::vector<uint8_t> Gzip(const std::vector<uint8_t>& data)
+    {
+        z_stream stream{};
+        deflateInit2(&stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 8, Z_DEFAULT_STRATEGY);
+        std::vector<uint8_t> out(deflateBound(&stream, static_cast<uLong>(data.size())));
+        stream.next_in = const_cast<Bytef*>(data.data());
+        stream.avail_in = static_cast<uInt>(data.size());
+        stream.next_out = out.data();
+        stream.avail_out = static_cast<uInt>(out.size());
+        deflate(&stream, Z_FINISH);
+        out.resize(stream.total_out);
+        deflateEnd(&stream);
+        return out;
+    }
+
+    void WriteFile(const std::string& path, const std::vector<uint8_t>& data)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    // A rivpack archive holding the payload as its only entry, laid out the
+    // way rivpack writes one
+    void WriteArchive(const std::string& path, const std::vector<uint8_t>& data)
+    {
+        const std::string name = "bench.riv";
+        RivArchiveHeader header{};
+        std::memcpy(header.magic, kRivArchiveMagic, sizeof(kRivArchiveMagic));
+        header.version = kRivArchiveVersion;
+        header.entryCount = 1;
+        header.bucketCount = 2;
+        header.alignment = 16;
+        header.tocOffset = sizeof(RivArchiveHeader);
+        header.bucketOffset = header.tocOffset + sizeof(RivArchiveEntry);
+        header.namesOffset = header.bucketOffset + 2 * sizeof(uint32_t);
+        header.namesSize = name.size();
+
+        RivArchiveEntry entry{};
+        entry.nameHash = RivArchiveHashName(name);
+        entry.nameLength = static_cast<uint32_t>(name.size());
+        entry.dataOffset = (header.namesOffset + header.namesSize + 15) & ~uint64_t(15);
+        entry.dataSize = data.size();
+        entry.flags = RivArchiveEntryRive;
+
+        uint32_t buckets[2] = {};
+        buckets[entry.nameHash & 1] = 1;
+        std::vector<char> padding(entry.dataOffset - header.namesOffset - header.namesSize);
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(&entry), sizeof(entry));
+        file.write(reinterpret_cast<const char*>(buckets), sizeof(buckets));
+        file.write(name.data(), static_cast<std::streamsize>(name.size()));
+        file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    using Bytes = std::shared_ptr<const std::vector<uint8_t>>;
+
+    void Report(const char* label, double best, size_t size)
+    {
+        std::printf("%-16s %8.2f ms  %8.1f MB/s\n", label, best * 1000.0, size / best / (1024.0 * 1024.0));
+    }
+
+    template <typename Load>
+    bool Measure(const char* label, int iterations, const std::vector<uint8_t>& expected, Load load)
+    {
+        double best = 1e9;
+        for (int i = 0; i < iterations; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            Bytes result = load();
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+            if (!result || *result != expected) {
+                std::printf("%-16s FAILED\n", label);
+                return false;
+            }
+            best = seconds < best ? seconds : best;
+        }
+        Report(label, best, expected.size());
+        return true;
+    }
+
+    // Open, look up and read every byte once in place, as an import from the
+    // mapping would; nothing is copied. The archive is closed between runs so
+    // each one maps afresh, though the pages stay in the page cache just as
+    // the raw read's do.
+    bool MeasureMapped(const char* label, int iterations, const std::string& path, const std::vector<uint8_t>& expected)
+    {
+        double best = 1e9;
+        for (int i = 0; i < iterations; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            auto archive = RivArchive::Open(path);
+            RivArchive::Entry entry;
+            if (!archive || !archive->Find("bench.riv", entry)) {
+                std::printf("%-16s FAILED\n", label);
+                return false;
+            }
+            uint64_t sum = 0;
+            for (size_t offset = 0; offset < entry.size; ++offset) {
+                sum += entry.data[offset];
+            }
+            double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            volatile uint64_t sink = sum;
+            (void)sink;
+            if (entry.size != expected.size() || std::memcmp(entry.data, expected.data(), expected.size()) != 0) {
+                std::printf("%-16s FAILED\n", label);
+                return false;
+            }
+            best = seconds < best ? seconds : best;
+        }
+        Report(label, best, expected.size());
+        return true;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t megabytes = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 32;
+    int iterations = argc > 2 ? std::atoi(argv[2]) : 5;
+
+    auto payload = MakePayload(megabytes * 1024 * 1024);
+    auto compressed = Gzip(payload);
+    std::printf("payload %zu bytes, gzip %zu bytes (%.1fx), best of %d\n",
+        payload.size(), compressed.size(), double(payload.size()) / compressed.size(), iterations);
+
+    const std::string rawPath = "riv_loader_benchmark.riv";
+    const std::string gzipPath = "riv_loader_benchmark.riv.gz";
+    const std::string archivePath = "riv_loader_benchmark.rivpack";
+    WriteFile(rawPath, payload);
+    WriteFile(gzipPath, compressed);
+    WriteArchive(archivePath, payload);
+
+    bool ok = true;
+    ok &= Measure("file raw", iterations, payload, [&]() { return RiveSourceLoader::ReadFile(rawPath); });
+    ok &= MeasureMapped("mmap archive", iterations, archivePath, payload);
+    ok &= Measure("file gzip", iterations, payload, [&]() { return RiveSourceLoader::ReadFile(gzipPath); });
+    ok &= Measure("memory gzip", iterations, payload, [&]() -> Bytes {
+        auto out = std::make_shared<std::vector<uint8_t>>();
+        return RiveSourceLoader::Decompress(compressed.data(), compressed.size(), *out) ? out : nullptr;
+    });
+
+    // A truncated stream must fail rather than return a short buffer
+    std::vector<uint8_t> truncated;
+    std::string error;
+    if (RiveSourceLoader::Decompress(compressed.data(), compressed.size() / 2, truncated, &error)) {
+        std::printf("truncated gzip was accepted\n");
+        ok = false;
+    }
+
+    std::remove(rawPath.c_str());
+    std::remove(gzipPath.c_str());
+    std::remove(archivePath.c_str());
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,143 @@
+// SlotBuffer, as RiveRenderer uses it for state machine notifications: fill
+// and take rounds that stop allocating once warmed up, the capacity bound,
+// and spare slots past the taken count.
+
+#include "../slot_buffer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+namespace {
+    std::atomic<size_t> g_allocations{ 0 };
+}
+
+void* operator new(size_t size)
+{
+    ++g_allocations;
+    if (void* block = std::malloc(size ? size : 1)) {
+        return block;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* block) noexcept
+{
+    std::free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    std::free(block);
+}
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    // Shaped like RiveRenderer::StateMachineNotification
+    struct Notification {
+        uint64_t frame = 0;
+        std::string name;
+    };
+
+    // The long names are the same length and too long for any small-string
+    // buffer, so once a slot's string has held one it never grows again
+    const char* const kNames[] = {
+        "Entry state of the main layer name",
+        "Button pressed event of the button",
+        "Exit",
+    };
+
+    void Fill(SlotBuffer<Notification>& buffer, uint64_t frame, size_t count)
+    {
+        for (size_t i = 0; i < count; ++i) {
+            auto* slot = buffer.Next();
+            if (!slot) {
+                return;
+            }
+            slot->frame = frame;
+            slot->name.assign(kNames[(frame + i) % 3]);
+        }
+    }
+
+    void TestFillAndTake()
+    {
+        SlotBuffer<Notification> buffer(16);
+        Fill(buffer, 1, 3);
+        Check(buffer.Count() == 3, "three filled");
+
+        std::vector<Notification> taken;
+        Check(buffer.Take(taken) == 3, "take returns the filled count");
+        Check(buffer.Count() == 0, "empty after a take");
+        Check(taken.size() >= 3 && taken[0].frame == 1 && taken[2].name == kNames[0], "taken in fill order");
+
+        // A smaller round: the count, not the vector size, says what's new
+        Fill(buffer, 2, 1);
+        Check(buffer.Take(taken) == 1, "only the new slot counted");
+        Check(taken[0].frame == 2 && taken[0].name == kNames[2], "new slot holds the new value");
+    }
+
+    void TestCapacity()
+    {
+        SlotBuffer<Notification> buffer(4);
+        Fill(buffer, 1, 4);
+        Check(buffer.Next() == nullptr, "no slot past the capacity");
+        Check(buffer.Count() == 4, "count stops at the capacity");
+
+        std::vector<Notification> taken;
+        Check(buffer.Take(taken) == 4, "the first four are kept");
+        Check(buffer.Next() != nullptr, "slots again after a take");
+    }
+
+    // Renderer and host swap the same two vectors back and forth, so once
+    // both have held a full round, neither the slots nor their strings are
+    // allocated again
+    void TestSteadyStateAllocatesNothing()
+    {
+        SlotBuffer<Notification> buffer(64);
+        std::vector<Notification> taken;
+        for (uint64_t frame = 0; frame < 4; ++frame) {
+            Fill(buffer, frame, 8);
+            buffer.Take(taken);
+        }
+
+        size_t before = g_allocations.load();
+        size_t delivered = 0;
+        for (uint64_t frame = 4; frame < 1004; ++frame) {
+            Fill(buffer, frame, 1 + frame % 8);
+            size_t count = buffer.Take(taken);
+            delivered += count;
+            if (count == 0 || taken[count - 1].frame != frame) {
+                std::printf("FAILED: frame %llu delivered %zu\n", static_cast<unsigned long long>(frame), count);
+                ++g_failures;
+                break;
+            }
+        }
+        Check(g_allocations.load() == before, "steady fill and take rounds allocate nothing");
+        Check(delivered > 1000, "every round delivered");
+    }
+}
+
+int main()
+{
+    TestFillAndTake();
+    TestCapacity();
+    TestSteadyStateAllocatesNothing();
+
+    if (g_failures == 0) {
+        std::printf("slot_buffer_test: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+// Just enough of rive::rcp and rive::ViewModelInstance for
+// viewmodel_instance_registry.cpp to build without a rive-runtime checkout.
+// Instances count themselves so tests can see when the registry lets go.
+
+#include <atomic>
+#include <cstddef>
+#include <utility>
+
+namespace rive {
+    template <typename T>
+    class rcp {
+    public:
+        rcp() = default;
+        rcp(std::nullptr_t) {}
+        explicit rcp(T* ptr) : m_ptr(ptr) {}
+        rcp(const rcp& other) : m_ptr(other.m_ptr) { if (m_ptr) m_ptr->ref(); }
+        rcp(rcp&& other) noexcept : m_ptr(std::exchange(other.m_ptr, nullptr)) {}
+        ~rcp() { if (m_ptr) m_ptr->unref(); }
+
+        rcp& operator=(rcp other) noexcept
+        {
+            std::swap(m_ptr, other.m_ptr);
+            return *this;
+        }
+
+        T* get() const { return m_ptr; }
+        T* operator->() const { return m_ptr; }
+        explicit operator bool() const { return m_ptr != nullptr; }
+
+    private:
+        T* m_ptr = nullptr;
+    };
+
+    template <typename T>
+    rcp<T> ref_rcp(T* ptr)
+    {
+        if (ptr) {
+            ptr->ref();
+        }
+        return rcp<T>(ptr);
+    }
+
+    template <typename T, typename... Args>
+    rcp<T> make_rcp(Args&&... args)
+    {
+        return rcp<T>(new T(std::forward<Args>(args)...));
+    }
+
+    class ViewModelInstance {
+    public:
+        static inline std::atomic<int> liveCount{ 0 };
+
+        ViewModelInstance() { ++liveCount; }
+        ~ViewModelInstance() { --liveCount; }
+
+        void ref() { ++m_refs; }
+        void unref()
+        {
+            if (--m_refs == 0) {
+                delete this;
+            }
+        }
+
+    private:
+        std::atomic<int> m_refs{ 1 };
+    };
+}
@@ -0,0 +1,145 @@
+// ViewModelInstanceRegistry memory growth: instances must go away with their
+// last reference, freed slots must be reused, and a slot whose generation is
+// used up must be retired rather than let a stale handle match again. Built
+// against stubs/ in place of the Rive runtime (see the Makefile).
+
+#include "../viewmodel_instance_registry.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    using Handle = ViewModelInstanceRegistry::Handle;
+
+    uint32_t SlotOf(Handle handle)
+    {
+        return (handle & ((1u << 20) - 1)) - 1;
+    }
+
+    int Live()
+    {
+        return rive::ViewModelInstance::liveCount.load();
+    }
+
+    void TestReleaseDropsInstance()
+    {
+        ViewModelInstanceRegistry registry;
+        auto instance = rive::make_rcp<rive::ViewModelInstance>();
+        const void* key = instance.get();
+        Handle handle = registry.Add(std::move(instance));
+        Check(handle != ViewModelInstanceRegistry::kInvalidHandle, "add returns a handle");
+        Check(registry.HandleOf(key) == handle, "handle found by instance");
+
+        // A second wrapper of the same instance shares the entry
+        Check(registry.Add(registry.Get(handle)) == handle, "adding again returns the same handle");
+        Check(!registry.Release(handle), "first of two releases keeps the entry");
+        Check(registry.Count() == 1 && Live() == 1, "instance alive while referenced");
+        Check(registry.Release(handle), "last release drops the entry");
+        Check(registry.Count() == 0 && Live() == 0, "instance freed by the last release");
+
+        Check(!registry.Retain(handle), "stale handle can't be retained");
+        Check(!registry.Release(handle), "stale handle can't be released");
+        Check(!registry.Get(handle), "stale handle finds nothing");
+    }
+
+    // Create-and-release churn, as a host making and dropping wrappers in a
+    // loop would do, must not grow the slot table or leak instances
+    void TestChurnReusesSlots()
+    {
+        ViewModelInstanceRegistry registry;
+        std::vector<Handle> held;
+        uint32_t highestSlot = 0;
+        for (int round = 0; round < 1000; ++round) {
+            for (int i = 0; i < 8; ++i) {
+                Handle handle = registry.Add(rive::make_rcp<rive::ViewModelInstance>());
+                highestSlot = std::max(highestSlot, SlotOf(handle));
+                held.push_back(handle);
+            }
+            for (Handle handle : held) {
+                registry.Release(handle);
+            }
+            held.clear();
+        }
+        Check(registry.Count() == 0, "churn leaves no entries");
+        Check(Live() == 0, "churn leaves no instances");
+        // 8000 adds at most 8 at a time; retirement every 4095 uses of a slot
+        // adds at most a couple of slots per original one
+        Check(highestSlot < 8 * 3, "churn reuses slots");
+    }
+
+    void TestGenerationRetiresSlot()
+    {
+        ViewModelInstanceRegistry registry;
+        Handle first = registry.Add(rive::make_rcp<rive::ViewModelInstance>());
+        registry.Release(first);
+
+        // Cycle the one slot until its generation runs out
+        Handle handle = first;
+        int cycles = 0;
+        while (SlotOf(handle) == SlotOf(first) && cycles < 5000) {
+            handle = registry.Add(rive::make_rcp<rive::ViewModelInstance>());
+            if (SlotOf(handle) == SlotOf(first)) {
+                registry.Release(handle);
+            }
+            ++cycles;
+        }
+        Check(SlotOf(handle) != SlotOf(first), "slot retired after its generations are used");
+        Check(cycles < 4096, "retired within one generation cycle");
+        Check(!registry.Retain(first), "first handle never matches again");
+        registry.Release(handle);
+        Check(registry.Count() == 0 && Live() == 0, "nothing left after retirement");
+    }
+
+    // Wrappers are released from whichever thread drops them last
+    void TestConcurrentChurn()
+    {
+        ViewModelInstanceRegistry registry;
+        auto shared = rive::make_rcp<rive::ViewModelInstance>();
+        Handle sharedHandle = registry.Add(shared);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&registry, &shared, sharedHandle]() {
+                for (int i = 0; i < 2000; ++i) {
+                    Handle own = registry.Add(rive::make_rcp<rive::ViewModelInstance>());
+                    registry.Add(shared);
+                    registry.Release(own);
+                    registry.Release(sharedHandle);
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        Check(registry.Count() == 1, "only the shared instance is left");
+        Check(registry.Release(sharedHandle), "shared instance released last");
+        shared = nullptr;
+        Check(Live() == 0, "concurrent churn leaves no instances");
+    }
+}
+
+int main()
+{
+    TestReleaseDropsInstance();
+    TestChurnReusesSlots();
+    TestGenerationRetiresSlot();
+    TestConcurrentChurn();
+
+    if (g_failures == 0) {
+        std::printf("viewmodel_instance_registry_test: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,93 @@
+// ViewModelInstance.Snapshot / Restore payload cost: blob size and encode /
+// decode time per value, for view models of each value type. Only the codec
+// is measured; reading and writing the native values happens on the render
+// thread and isn't modelled here.
+//
+//   ./viewmodel_snapshot_benchmark [rounds]
+
+#include "../viewmodel_snapshot.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace {
+    using Clock = std::chrono::steady_clock;
+
+    struct Shape {
+        const char* name;
+        ViewModelSnapshotTag tag;
+    };
+
+    void AppendValue(ViewModelSnapshotWriter& writer, ViewModelSnapshotTag tag, size_t slot, const std::string& text)
+    {
+        switch (tag) {
+        case ViewModelSnapshotTag::String:
+            writer.AppendString(text);
+            break;
+        case ViewModelSnapshotTag::Number:
+            writer.AppendNumber(static_cast<float>(slot) * 0.5f);
+            break;
+        case ViewModelSnapshotTag::Boolean:
+            writer.AppendBoolean(slot & 1);
+            break;
+        case ViewModelSnapshotTag::Color:
+            writer.AppendColor(0xFF000000u | static_cast<uint32_t>(slot));
+            break;
+        case ViewModelSnapshotTag::Enum:
+            writer.AppendEnum(static_cast<uint32_t>(slot % 4));
+            break;
+        default:
+            writer.AppendNone();
+            break;
+        }
+    }
+}
+
+int main(int argc, char** argv)
+{
+    size_t rounds = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+    const size_t count = 64;
+    const std::string text = "Label text of 24 bytes..";
+
+    const Shape shapes[] = {
+        { "string (24 B)", ViewModelSnapshotTag::String },
+        { "number", ViewModelSnapshotTag::Number },
+        { "boolean", ViewModelSnapshotTag::Boolean },
+        { "color", ViewModelSnapshotTag::Color },
+        { "enum", ViewModelSnapshotTag::Enum },
+        { "none", ViewModelSnapshotTag::None },
+    };
+
+    std::printf("%d values per view model, %zu rounds\n", static_cast<int>(count), rounds);
+    std::printf("%-16s %10s %12s %14s %14s\n", "values", "blob B", "B / value", "encode ns/val", "decode ns/val");
+    for (const auto& shape : shapes) {
+        std::vector<uint8_t> blob;
+        auto start = Clock::now();
+        for (size_t round = 0; round < rounds; ++round) {
+            ViewModelSnapshotWriter writer(0x1234, count);
+            for (size_t slot = 0; slot < count; ++slot) {
+                AppendValue(writer, shape.tag, slot, text);
+            }
+            blob = writer.Take();
+        }
+        double encode = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (rounds * count);
+
+        std::vector<ViewModelSnapshotValue> values;
+        start = Clock::now();
+        for (size_t round = 0; round < rounds; ++round) {
+            if (DecodeViewModelSnapshot(blob.data(), blob.size(), 0x1234, count, values) != ViewModelSnapshotStatus::Ok ||
+                values.size() != count || values[count - 1].tag != shape.tag) {
+                std::printf("%s: snapshot did not round trip\n", shape.name);
+                return 1;
+            }
+        }
+        double decode = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / (rounds * count);
+
+        std::printf("%-16s %10zu %12.1f %14.1f %14.1f\n", shape.name, blob.size(),
+                    static_cast<double>(blob.size() - kViewModelSnapshotHeaderSize) / count, encode, decode);
+    }
+    return 0;
+}
@@ -0,0 +1,193 @@
+// View model snapshot encoding and decoding: round trips, truncated and
+// padded blobs, counts the blob can't hold, and fingerprints that must
+// change when a property is renamed, retyped or moved.
+
+#include "../viewmodel_snapshot.h"
+
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool condition, const char* what)
+    {
+        if (!condition) {
+            std::printf("FAILED: %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    struct Property {
+        const char* name;
+        uint8_t type;
+    };
+
+    uint64_t Fingerprint(const std::vector<Property>& properties)
+    {
+        ViewModelFingerprint fingerprint;
+        for (const auto& property : properties) {
+            fingerprint.Add(property.name, property.type);
+        }
+        return fingerprint.Value();
+    }
+
+    const std::vector<Property> kSchema = {
+        { "title", 0 }, { "progress", 1 }, { "enabled", 2 }, { "accent", 3 }, { "mode", 4 }, { "tap", 5 },
+    };
+
+    std::vector<uint8_t> Encode(uint64_t fingerprint)
+    {
+        ViewModelSnapshotWriter writer(fingerprint, 6);
+        writer.AppendString("Hello, world");
+        writer.AppendNumber(0.25f);
+        writer.AppendBoolean(true);
+        writer.AppendColor(0xFF336699u);
+        writer.AppendEnum(3);
+        writer.AppendNone();
+        return writer.Take();
+    }
+
+    ViewModelSnapshotStatus Decode(const std::vector<uint8_t>& blob, uint64_t fingerprint, uint32_t count,
+                                   std::vector<ViewModelSnapshotValue>& values)
+    {
+        return DecodeViewModelSnapshot(blob.data(), blob.size(), fingerprint, count, values);
+    }
+
+    void TestRoundTrip()
+    {
+        uint64_t fingerprint = Fingerprint(kSchema);
+        auto blob = Encode(fingerprint);
+        Check(blob.size() == kViewModelSnapshotHeaderSize + (5 + 12) + 5 + 2 + 5 + 5 + 1, "blob size matches the layout");
+
+        std::vector<ViewModelSnapshotValue> values;
+        Check(Decode(blob, fingerprint, 6, values) == ViewModelSnapshotStatus::Ok, "round trip decodes");
+        Check(values.size() == 6, "one value per slot");
+        if (values.size() != 6) {
+            return;
+        }
+        Check(values[0].tag == ViewModelSnapshotTag::String && values[0].text == "Hello, world", "string value");
+        Check(values[1].tag == ViewModelSnapshotTag::Number && values[1].number == 0.25, "number value");
+        Check(values[2].tag == ViewModelSnapshotTag::Boolean && values[2].number == 1.0, "boolean value");
+        Check(values[3].tag == ViewModelSnapshotTag::Color && static_cast<uint32_t>(values[3].number) == 0xFF336699u,
+              "color value keeps all 32 bits");
+        Check(values[4].tag == ViewModelSnapshotTag::Enum && values[4].number == 3.0, "enum value");
+        Check(values[5].tag == ViewModelSnapshotTag::None, "none value");
+    }
+
+    void TestTruncated()
+    {
+        uint64_t fingerprint = Fingerprint(kSchema);
+        auto blob = Encode(fingerprint);
+        std::vector<ViewModelSnapshotValue> values;
+        for (size_t size = 0; size < blob.size(); ++size) {
+            auto status = DecodeViewModelSnapshot(blob.data(), size, fingerprint, 6, values);
+            if (status != ViewModelSnapshotStatus::Malformed || !values.empty()) {
+                std::printf("FAILED: truncated to %zu bytes decoded\n", size);
+                ++g_failures;
+            }
+        }
+        Check(DecodeViewModelSnapshot(nullptr, 0, fingerprint, 6, values) == ViewModelSnapshotStatus::Malformed,
+              "null blob is malformed");
+    }
+
+    void TestTrailingBytes()
+    {
+        uint64_t fingerprint = Fingerprint(kSchema);
+        auto blob = Encode(fingerprint);
+        blob.push_back(0);
+        std::vector<ViewModelSnapshotValue> values;
+        Check(Decode(blob, fingerprint, 6, values) == ViewModelSnapshotStatus::Malformed, "trailing bytes are malformed");
+        Check(values.empty(), "no values after trailing bytes");
+    }
+
+    void TestBadHeader()
+    {
+        uint64_t fingerprint = Fingerprint(kSchema);
+        std::vector<ViewModelSnapshotValue> values;
+
+        auto blob = Encode(fingerprint);
+        blob[0] ^= 0xFF;
+        Check(Decode(blob, fingerprint, 6, values) == ViewModelSnapshotStatus::Malformed, "bad magic is malformed");
+
+        blob = Encode(fingerprint);
+        blob[4] = kViewModelSnapshotVersion + 1;
+        Check(Decode(blob, fingerprint, 6, values) == ViewModelSnapshotStatus::Malformed, "other version is malformed");
+
+        blob = Encode(fingerprint);
+        blob[20] = 0x7F;
+        Check(Decode(blob, fingerprint, 6, values) == ViewModelSnapshotStatus::Malformed, "unknown tag is malformed");
+    }
+
+    void TestSchemaMismatch()
+    {
+        uint64_t fingerprint = Fingerprint(kSchema);
+        auto blob = Encode(fingerprint);
+        std::vector<ViewModelSnapshotValue> values;
+        Check(Decode(blob, fingerprint + 1, 6, values) == ViewModelSnapshotStatus::SchemaMismatch,
+              "other fingerprint is a schema mismatch");
+        Check(Decode(blob, fingerprint, 7, values) == ViewModelSnapshotStatus::SchemaMismatch,
+              "other slot count is a schema mismatch");
+    }
+
+    // A header claiming more slots than there are bytes is rejected before
+    // the decoder sizes anything for it
+    void TestOversizedCount()
+    {
+        ViewModelSnapshotWriter writer(1, 1);
+        writer.AppendNone();
+        auto blob = writer.Take();
+        for (size_t i = kViewModelSnapshotHeaderSize - 4; i < kViewModelSnapshotHeaderSize; ++i) {
+            blob[i] = 0xFF;  // slot count
+        }
+        std::vector<ViewModelSnapshotValue> values;
+        Check(Decode(blob, 1, 0xFFFFFFFFu, values) == ViewModelSnapshotStatus::Malformed, "oversized count is malformed");
+        Check(values.capacity() == 0, "oversized count reserves nothing");
+
+        ViewModelSnapshotWriter text(1, 1);
+        text.AppendString("abc");
+        blob = text.Take();
+        blob[kViewModelSnapshotHeaderSize + 1] = 0xFF;  // length low byte: 0xFF
+        Check(Decode(blob, 1, 1, values) == ViewModelSnapshotStatus::Malformed, "string past the end is malformed");
+    }
+
+    void TestFingerprint()
+    {
+        uint64_t base = Fingerprint(kSchema);
+        Check(base == Fingerprint(kSchema), "fingerprint is stable");
+
+        auto retyped = kSchema;
+        retyped[1].type = 4;
+        Check(Fingerprint(retyped) != base, "retyping a property changes the fingerprint");
+
+        auto renamed = kSchema;
+        renamed[0].name = "titles";
+        Check(Fingerprint(renamed) != base, "renaming a property changes the fingerprint");
+
+        auto swapped = kSchema;
+        std::swap(swapped[0], swapped[1]);
+        Check(Fingerprint(swapped) != base, "reordering properties changes the fingerprint");
+
+        // The terminator keeps "ab" + "c" apart from "a" + "bc"
+        Check(Fingerprint({ { "ab", 0 }, { "c", 0 } }) != Fingerprint({ { "a", 0 }, { "bc", 0 } }),
+              "name boundaries are part of the fingerprint");
+    }
+}
+
+int main()
+{
+    TestRoundTrip();
+    TestTruncated();
+    TestTrailingBytes();
+    TestBadHeader();
+    TestSchemaMismatch();
+    TestOversizedCount();
+    TestFingerprint();
+
+    if (g_failures == 0) {
+        std::printf("viewmodel_snapshot_test: all passed\n");
+    }
+    return g_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+
+// Hash for string-keyed maps that accepts std::string_view lookups without
+// building a temporary std::string
+struct TransparentStringHash {
+    using is_transparent = void;
+    size_t operator()(std::string_view value) const { return std::hash<std::string_view>{}(value); }
+};
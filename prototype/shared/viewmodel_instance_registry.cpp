@@ -0,0 +1,131 @@
+#include "viewmodel_instance_registry.h"
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+ViewModelInstanceRegistry::Handle ViewModelInstanceRegistry::Add(rive::rcp<rive::ViewModelInstance> instance)
+{
+    if (!instance) {
+        return kInvalidHandle;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const void* key = instance.get();
+    auto existing = m_slotByInstance.find(key);
+    if (existing != m_slotByInstance.end()) {
+        Slot& slot = m_slots[existing->second];
+        ++slot.references;
+        return MakeHandle(existing->second, slot.generation);
+    }
+
+    uint32_t index;
+    if (!m_freeSlots.empty()) {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        if (m_slots.size() >= kSlotMask) {
+            return kInvalidHandle;
+        }
+        index = static_cast<uint32_t>(m_slots.size());
+        m_slots.emplace_back();
+    }
+
+    Slot& slot = m_slots[index];
+    slot.instance = std::move(instance);
+    slot.key = key;
+    slot.references = 1;
+    m_slotByInstance.emplace(key, index);
+    return MakeHandle(index, slot.generation);
+}
+
+rive::rcp<rive::ViewModelInstance> ViewModelInstanceRegistry::Get(Handle handle) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const Slot* slot = SlotForLocked(handle);
+    return slot ? slot->instance : nullptr;
+}
+
+rive::rcp<rive::ViewModelInstance> ViewModelInstanceRegistry::Find(const void* instance) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_slotByInstance.find(instance);
+    return it != m_slotByInstance.end() ? m_slots[it->second].instance : nullptr;
+}
+
+std::vector<rive::rcp<rive::ViewModelInstance>> ViewModelInstanceRegistry::Instances() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<rive::rcp<rive::ViewModelInstance>> instances;
+    instances.reserve(m_slotByInstance.size());
+    for (const auto& entry : m_slotByInstance) {
+        instances.push_back(m_slots[entry.second].instance);
+    }
+    return instances;
+}
+#endif
+
+ViewModelInstanceRegistry::Handle ViewModelInstanceRegistry::HandleOf(const void* instance) const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_slotByInstance.find(instance);
+    return it != m_slotByInstance.end() ? MakeHandle(it->second, m_slots[it->second].generation) : kInvalidHandle;
+}
+
+bool ViewModelInstanceRegistry::Retain(Handle handle)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Slot* slot = SlotForLocked(handle);
+    if (!slot) {
+        return false;
+    }
+    ++slot->references;
+    return true;
+}
+
+bool ViewModelInstanceRegistry::Release(Handle handle)
+{
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    // Dropped outside the lock - the instance's destructor may be long
+    rive::rcp<rive::ViewModelInstance> dropped;
+#endif
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Slot* slot = SlotForLocked(handle);
+        if (!slot || --slot->references > 0) {
+            return false;
+        }
+
+        uint32_t index = (handle & kSlotMask) - 1;
+        m_slotByInstance.erase(slot->key);
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        dropped = std::move(slot->instance);
+#endif
+        slot->key = nullptr;
+        // Retire the slot once its generation is used up rather than let an
+        // old handle match again
+        slot->generation = (slot->generation + 1) & kGenerationMask;
+        if (slot->generation != 0) {
+            m_freeSlots.push_back(index);
+        }
+    }
+    return true;
+}
+
+size_t ViewModelInstanceRegistry::Count() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_slotByInstance.size();
+}
+
+ViewModelInstanceRegistry::Slot* ViewModelInstanceRegistry::SlotForLocked(Handle handle)
+{
+    uint32_t index = (handle & kSlotMask);
+    if (index == 0 || index > m_slots.size()) {
+        return nullptr;
+    }
+    Slot& slot = m_slots[index - 1];
+    return slot.key && slot.generation == (handle >> kSlotBits) ? &slot : nullptr;
+}
+
+const ViewModelInstanceRegistry::Slot* ViewModelInstanceRegistry::SlotForLocked(Handle handle) const
+{
+    return const_cast<ViewModelInstanceRegistry*>(this)->SlotForLocked(handle);
+}
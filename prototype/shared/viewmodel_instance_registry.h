@@ -0,0 +1,68 @@
+#pragma once
+
+// Owner of the view model instances handed out to hosts. An entry holds its
+// instance while any host wrapper references it and is dropped by the last
+// Release; an instance that is still bound (artboard, scene, resident state
+// machines) stays alive through those references until it is unbound, then
+// goes away with them. Entries are addressed in O(1) either by handle - slot
+// index plus a generation, so a stale handle never finds the slot's next
+// occupant - or by instance pointer.
+//
+// Thread-safe. Wrappers share ownership of the registry, so releasing after
+// the renderer has gone is harmless.
+
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+#include "rive/viewmodel/viewmodel_instance.hpp"
+#endif
+
+class ViewModelInstanceRegistry {
+public:
+    using Handle = uint32_t;
+    static constexpr Handle kInvalidHandle = 0;
+
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+    // Register an instance with one reference, owned by the caller. Adding
+    // an instance that is already registered takes another reference.
+    Handle Add(rive::rcp<rive::ViewModelInstance> instance);
+    rive::rcp<rive::ViewModelInstance> Get(Handle handle) const;
+    rive::rcp<rive::ViewModelInstance> Find(const void* instance) const;
+    std::vector<rive::rcp<rive::ViewModelInstance>> Instances() const;
+#endif
+
+    Handle HandleOf(const void* instance) const;   // kInvalidHandle when not registered
+    bool Retain(Handle handle);
+    // Returns true when this was the last reference and the entry was dropped
+    bool Release(Handle handle);
+
+    size_t Count() const;
+
+private:
+    // 20 bits of slot (plus one, so 0 stays invalid) and 12 of generation
+    static constexpr uint32_t kSlotBits = 20;
+    static constexpr uint32_t kSlotMask = (1u << kSlotBits) - 1;
+    static constexpr uint32_t kGenerationMask = (1u << (32 - kSlotBits)) - 1;
+
+    struct Slot {
+#if defined(WITH_RIVE_TEXT) && defined(RIVE_HEADERS_AVAILABLE)
+        rive::rcp<rive::ViewModelInstance> instance;
+#endif
+        const void* key = nullptr;
+        uint32_t references = 0;
+        uint32_t generation = 1;
+    };
+
+    Slot* SlotForLocked(Handle handle);
+    const Slot* SlotForLocked(Handle handle) const;
+    static Handle MakeHandle(uint32_t slot, uint32_t generation) { return (generation << kSlotBits) | (slot + 1); }
+
+    mutable std::mutex m_mutex;
+    std::vector<Slot> m_slots;
+    std::vector<uint32_t> m_freeSlots;
+    std::unordered_map<const void*, uint32_t> m_slotByInstance;
+};
@@ -0,0 +1,172 @@
+#include "viewmodel_snapshot.h"
+
+#include <cstring>
+
+namespace {
+    template <typename T>
+    void AppendRaw(std::vector<uint8_t>& bytes, T value)
+    {
+        size_t offset = bytes.size();
+        bytes.resize(offset + sizeof(T));
+        memcpy(bytes.data() + offset, &value, sizeof(T));
+    }
+
+    template <typename T>
+    bool ReadRaw(const uint8_t*& cursor, const uint8_t* end, T& value)
+    {
+        if (static_cast<size_t>(end - cursor) < sizeof(T)) {
+            return false;
+        }
+        memcpy(&value, cursor, sizeof(T));
+        cursor += sizeof(T);
+        return true;
+    }
+}
+
+void ViewModelFingerprint::Add(std::string_view name, uint8_t type)
+{
+    for (unsigned char c : name) {
+        m_hash = (m_hash ^ c) * 1099511628211ull;
+    }
+    m_hash = m_hash * 1099511628211ull;
+    m_hash = (m_hash ^ type) * 1099511628211ull;
+}
+
+ViewModelSnapshotWriter::ViewModelSnapshotWriter(uint64_t fingerprint, uint32_t count)
+{
+    // Most values are a tag and four bytes
+    m_bytes.reserve(kViewModelSnapshotHeaderSize + static_cast<size_t>(count) * (1 + sizeof(float)));
+    AppendRaw(m_bytes, kViewModelSnapshotMagic);
+    AppendRaw(m_bytes, kViewModelSnapshotVersion);
+    AppendRaw(m_bytes, uint16_t(0));
+    AppendRaw(m_bytes, fingerprint);
+    AppendRaw(m_bytes, count);
+}
+
+void ViewModelSnapshotWriter::AppendNone()
+{
+    AppendRaw(m_bytes, ViewModelSnapshotTag::None);
+}
+
+void ViewModelSnapshotWriter::AppendString(std::string_view text)
+{
+    AppendRaw(m_bytes, ViewModelSnapshotTag::String);
+    AppendRaw(m_bytes, static_cast<uint32_t>(text.size()));
+    m_bytes.insert(m_bytes.end(), text.begin(), text.end());
+}
+
+void ViewModelSnapshotWriter::AppendNumber(float value)
+{
+    AppendRaw(m_bytes, ViewModelSnapshotTag::Number);
+    AppendRaw(m_bytes, value);
+}
+
+void ViewModelSnapshotWriter::AppendBoolean(bool value)
+{
+    AppendRaw(m_bytes, ViewModelSnapshotTag::Boolean);
+    AppendRaw(m_bytes, static_cast<uint8_t>(value ? 1 : 0));
+}
+
+void ViewModelSnapshotWriter::AppendColor(uint32_t value)
+{
+    AppendRaw(m_bytes, ViewModelSnapshotTag::Color);
+    AppendRaw(m_bytes, value);
+}
+
+void ViewModelSnapshotWriter::AppendEnum(uint32_t value)
+{
+    AppendRaw(m_bytes, ViewModelSnapshotTag::Enum);
+    AppendRaw(m_bytes, value);
+}
+
+ViewModelSnapshotStatus DecodeViewModelSnapshot(const uint8_t* data, size_t size,
+                                                uint64_t fingerprint, uint32_t count,
+                                                std::vector<ViewModelSnapshotValue>& values)
+{
+    values.clear();
+    if (!data || size < kViewModelSnapshotHeaderSize) {
+        return ViewModelSnapshotStatus::Malformed;
+    }
+
+    const uint8_t* cursor = data;
+    const uint8_t* end = data + size;
+    uint32_t magic = 0;
+    uint16_t version = 0;
+    uint16_t reserved = 0;
+    uint64_t blobFingerprint = 0;
+    uint32_t blobCount = 0;
+    ReadRaw(cursor, end, magic);
+    ReadRaw(cursor, end, version);
+    ReadRaw(cursor, end, reserved);
+    ReadRaw(cursor, end, blobFingerprint);
+    ReadRaw(cursor, end, blobCount);
+    if (magic != kViewModelSnapshotMagic || version != kViewModelSnapshotVersion) {
+        return ViewModelSnapshotStatus::Malformed;
+    }
+    if (blobFingerprint != fingerprint || blobCount != count) {
+        return ViewModelSnapshotStatus::SchemaMismatch;
+    }
+
+    // Every slot costs at least its tag, so a count the blob can't hold is
+    // rejected before anything is reserved for it
+    if (static_cast<size_t>(end - cursor) < count) {
+        return ViewModelSnapshotStatus::Malformed;
+    }
+    values.resize(count);
+
+    for (auto& value : values) {
+        if (!ReadRaw(cursor, end, value.tag)) {
+            values.clear();
+            return ViewModelSnapshotStatus::Malformed;
+        }
+
+        bool ok = true;
+        switch (value.tag) {
+        case ViewModelSnapshotTag::None:
+            break;
+        case ViewModelSnapshotTag::String: {
+            uint32_t length = 0;
+            ok = ReadRaw(cursor, end, length) && static_cast<size_t>(end - cursor) >= length;
+            if (ok) {
+                value.text.assign(reinterpret_cast<const char*>(cursor), length);
+                cursor += length;
+            }
+            break;
+        }
+        case ViewModelSnapshotTag::Number: {
+            float number = 0.0f;
+            ok = ReadRaw(cursor, end, number);
+            value.number = number;
+            break;
+        }
+        case ViewModelSnapshotTag::Boolean: {
+            uint8_t flag = 0;
+            ok = ReadRaw(cursor, end, flag);
+            value.number = flag ? 1.0 : 0.0;
+            break;
+        }
+        case ViewModelSnapshotTag::Color:
+        case ViewModelSnapshotTag::Enum: {
+            uint32_t bits = 0;
+            ok = ReadRaw(cursor, end, bits);
+            value.number = static_cast<double>(bits);
+            break;
+        }
+        default:
+            ok = false;
+            break;
+        }
+
+        if (!ok) {
+            values.clear();
+            return ViewModelSnapshotStatus::Malformed;
+        }
+    }
+
+    // Trailing bytes mean the blob isn't what its header says
+    if (cursor != end) {
+        values.clear();
+        return ViewModelSnapshotStatus::Malformed;
+    }
+    return ViewModelSnapshotStatus::Ok;
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+// Binary snapshot of one view model instance's values, laid out by schema
+// slot with no names. Layout, little endian:
+//
+//   u32 magic, u16 version, u16 reserved, u64 schema fingerprint,
+//   u32 slot count, then per slot a u8 tag and its payload -
+//   string: u32 byte length + UTF-8, number: f32, boolean: u8,
+//   color: u32, enum: u32, none: nothing
+//
+// The codec knows nothing about the Rive runtime or WinRT; the instance
+// wrapper reads and writes the native values and checks each decoded tag
+// against the slot's property type.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+constexpr uint32_t kViewModelSnapshotMagic = 0x494D5652; // "RVMI"
+constexpr uint16_t kViewModelSnapshotVersion = 2;
+constexpr size_t kViewModelSnapshotHeaderSize = 20;
+
+// FNV-1a over each property's name, a terminator and its type, in slot
+// order. Two schemas with the same fingerprint lay out their values the
+// same way, so a snapshot of one restores into the other.
+class ViewModelFingerprint {
+public:
+    void Add(std::string_view name, uint8_t type);
+    uint64_t Value() const { return m_hash; }
+
+private:
+    uint64_t m_hash = 14695981039346656037ull;
+};
+
+enum class ViewModelSnapshotTag : uint8_t {
+    None = 0,
+    String,
+    Number,
+    Boolean,
+    Color,
+    Enum,
+};
+
+struct ViewModelSnapshotValue {
+    ViewModelSnapshotTag tag = ViewModelSnapshotTag::None;
+    double number = 0.0;    // Number, 0 / 1 for Boolean, the bits of Color and Enum
+    std::string text;       // String
+};
+
+class ViewModelSnapshotWriter {
+public:
+    // Writes the header; exactly count values must follow
+    ViewModelSnapshotWriter(uint64_t fingerprint, uint32_t count);
+
+    void AppendNone();
+    void AppendString(std::string_view text);
+    void AppendNumber(float value);
+    void AppendBoolean(bool value);
+    void AppendColor(uint32_t value);
+    void AppendEnum(uint32_t value);
+
+    const std::vector<uint8_t>& Bytes() const { return m_bytes; }
+    std::vector<uint8_t> Take() { return std::move(m_bytes); }
+
+private:
+    std::vector<uint8_t> m_bytes;
+};
+
+enum class ViewModelSnapshotStatus {
+    Ok,
+    Malformed,          // Not a snapshot, an unknown version, or truncated
+    SchemaMismatch,     // Taken from a view model with a different layout
+};
+
+// Decodes a whole snapshot into values, one per slot, before anything is
+// applied. Values is left empty unless the result is Ok.
+ViewModelSnapshotStatus DecodeViewModelSnapshot(const uint8_t* data, size_t size,
+                                                uint64_t fingerprint, uint32_t count,
+                                                std::vector<ViewModelSnapshotValue>& values);
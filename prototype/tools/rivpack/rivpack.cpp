@@ -0,0 +1,246 @@
+// rivpack - packs .riv files and shared assets into a .rivpack archive that
+// RiveRenderer::LoadRiveFileFromArchive maps and reads in place.
+//
+//   rivpack [--align N] <output.rivpack> <input>...
+//   rivpack --list <archive.rivpack>
+//
+// Inputs may be files or directories (searched recursively). Entries are named
+// by their path relative to the input they came from, with '/' separators,
+// e.g. "buttons/toggle.riv". Files ending in .riv (or a gzip-compressed
+// .riv.gz) are flagged as Rive entries, everything else as assets.
+
+#include "../../shared/riv_archive.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+    constexpr uint32_t kDefaultAlignment = 16;
+
+    struct InputFile {
+        std::string name;
+        fs::path path;
+        uint32_t flags = 0;
+    };
+
+    bool EndsWith(const std::string& value, const char* suffix)
+    {
+        const size_t length = std::strlen(suffix);
+        return value.size() >= length && value.compare(value.size() - length, length, suffix) == 0;
+    }
+
+    uint32_t FlagsForName(const std::string& name)
+    {
+        std::string lower = name;
+        std::transform(lower.begin(), lower.end(), lower.begin(),
+            [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+        if (EndsWith(lower, ".riv") || EndsWith(lower, ".riv.gz")) {
+            return RivArchiveEntryRive;
+        }
+        return RivArchiveEntryAsset;
+    }
+
+    void AddInput(const fs::path& input, std::vector<InputFile>& files)
+    {
+        if (fs::is_directory(input)) {
+            for (const auto& item : fs::recursive_directory_iterator(input)) {
+                if (item.is_regular_file()) {
+                    InputFile file;
+                    file.name = fs::relative(item.path(), input).generic_string();
+                    file.path = item.path();
+                    file.flags = FlagsForName(file.name);
+                    files.push_back(std::move(file));
+                }
+            }
+        } else {
+            InputFile file;
+            file.name = input.filename().generic_string();
+            file.path = input;
+            file.flags = FlagsForName(file.name);
+            files.push_back(std::move(file));
+        }
+    }
+
+    uint64_t AlignUp(uint64_t value, uint64_t alignment)
+    {
+        return (value + alignment - 1) / alignment * alignment;
+    }
+
+    bool ReadAll(const fs::path& path, std::vector<uint8_t>& out)
+    {
+        std::ifstream stream(path, std::ios::binary | std::ios::ate);
+        if (!stream) {
+            return false;
+        }
+        out.resize(static_cast<size_t>(stream.tellg()));
+        stream.seekg(0);
+        return out.empty() || stream.read(reinterpret_cast<char*>(out.data()), out.size()).good();
+    }
+
+    int Pack(const std::string& outputPath, const std::vector<std::string>& inputs, uint32_t alignment)
+    {
+        std::vector<InputFile> files;
+        for (const auto& input : inputs) {
+            if (!fs::exists(input)) {
+                std::cerr << "rivpack: no such file or directory: " << input << "\n";
+                return 1;
+            }
+            AddInput(input, files);
+        }
+
+        // Sorted names keep archives reproducible for identical inputs
+        std::sort(files.begin(), files.end(),
+            [](const InputFile& a, const InputFile& b) { return a.name < b.name; });
+        std::unordered_set<std::string> seen;
+        for (const auto& file : files) {
+            if (!seen.insert(file.name).second) {
+                std::cerr << "rivpack: duplicate entry name: " << file.name << "\n";
+                return 1;
+            }
+        }
+
+        const uint32_t entryCount = static_cast<uint32_t>(files.size());
+        uint32_t bucketCount = 2;
+        while (bucketCount < entryCount * 2) {
+            bucketCount *= 2;
+        }
+
+        // Names blob
+        std::string names;
+        std::vector<RivArchiveEntry> entries(entryCount);
+        for (uint32_t i = 0; i < entryCount; ++i) {
+            entries[i] = {};
+            entries[i].nameHash = RivArchiveHashName(files[i].name);
+            entries[i].nameOffset = static_cast<uint32_t>(names.size());
+            entries[i].nameLength = static_cast<uint32_t>(files[i].name.size());
+            entries[i].flags = files[i].flags;
+            names += files[i].name;
+        }
+
+        // Hash buckets - entry index + 1, linear probing
+        std::vector<uint32_t> buckets(bucketCount, 0);
+        for (uint32_t i = 0; i < entryCount; ++i) {
+            uint64_t slot = entries[i].nameHash & (bucketCount - 1);
+            while (buckets[slot] != 0) {
+                slot = (slot + 1) & (bucketCount - 1);
+            }
+            buckets[slot] = i + 1;
+        }
+
+        RivArchiveHeader header{};
+        std::memcpy(header.magic, kRivArchiveMagic, sizeof(kRivArchiveMagic));
+        header.version = kRivArchiveVersion;
+        header.entryCount = entryCount;
+        header.bucketCount = bucketCount;
+        header.alignment = alignment;
+        header.tocOffset = sizeof(RivArchiveHeader);
+        header.bucketOffset = header.tocOffset + uint64_t(entryCount) * sizeof(RivArchiveEntry);
+        header.namesOffset = header.bucketOffset + uint64_t(bucketCount) * sizeof(uint32_t);
+        header.namesSize = names.size();
+
+        uint64_t offset = header.namesOffset + header.namesSize;
+        for (uint32_t i = 0; i < entryCount; ++i) {
+            std::error_code ec;
+            const auto size = fs::file_size(files[i].path, ec);
+            if (ec) {
+                std::cerr << "rivpack: cannot read " << files[i].path << "\n";
+                return 1;
+            }
+            offset = AlignUp(offset, alignment);
+            entries[i].dataOffset = offset;
+            entries[i].dataSize = size;
+            offset += size;
+        }
+
+        std::ofstream out(outputPath, std::ios::binary | std::ios::trunc);
+        if (!out) {
+            std::cerr << "rivpack: cannot create " << outputPath << "\n";
+            return 1;
+        }
+        out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        out.write(reinterpret_cast<const char*>(entries.data()), entries.size() * sizeof(RivArchiveEntry));
+        out.write(reinterpret_cast<const char*>(buckets.data()), buckets.size() * sizeof(uint32_t));
+        out.write(names.data(), names.size());
+
+        uint64_t written = header.namesOffset + header.namesSize;
+        std::vector<uint8_t> data;
+        for (uint32_t i = 0; i < entryCount; ++i) {
+            if (!ReadAll(files[i].path, data) || data.size() != entries[i].dataSize) {
+                std::cerr << "rivpack: cannot read " << files[i].path << "\n";
+                return 1;
+            }
+            static const char padding[4096] = {};
+            while (written < entries[i].dataOffset) {
+                const auto count = std::min<uint64_t>(entries[i].dataOffset - written, sizeof(padding));
+                out.write(padding, static_cast<std::streamsize>(count));
+                written += count;
+            }
+            out.write(reinterpret_cast<const char*>(data.data()), data.size());
+            written += data.size();
+        }
+
+        if (!out.good()) {
+            std::cerr << "rivpack: write failed for " << outputPath << "\n";
+            return 1;
+        }
+        std::cout << "Packed " << entryCount << " entries (" << written << " bytes) into " << outputPath << "\n";
+        return 0;
+    }
+
+    int List(const std::string& archivePath)
+    {
+        std::string error;
+        auto archive = RivArchive::Open(archivePath, &error);
+        if (!archive) {
+            std::cerr << "rivpack: " << error << "\n";
+            return 1;
+        }
+
+        for (size_t i = 0; i < archive->GetEntryCount(); ++i) {
+            auto entry = archive->GetEntryAt(i);
+            std::cout << (entry.flags & RivArchiveEntryRive ? "riv   " : "asset ")
+                      << entry.size << "\t" << entry.name << "\n";
+        }
+        return 0;
+    }
+
+    void PrintUsage()
+    {
+        std::cerr << "usage: rivpack [--align N] <output.rivpack> <input>...\n"
+                  << "       rivpack --list <archive.rivpack>\n";
+    }
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<std::string> args(argv + 1, argv + argc);
+    if (args.size() == 2 && args[0] == "--list") {
+        return List(args[1]);
+    }
+
+    uint32_t alignment = kDefaultAlignment;
+    if (args.size() >= 2 && args[0] == "--align") {
+        alignment = static_cast<uint32_t>(std::strtoul(args[1].c_str(), nullptr, 10));
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0) {
+            std::cerr << "rivpack: --align must be a power of two\n";
+            return 1;
+        }
+        args.erase(args.begin(), args.begin() + 2);
+    }
+
+    if (args.size() < 2) {
+        PrintUsage();
+        return 1;
+    }
+
+    return Pack(args[0], std::vector<std::string>(args.begin() + 1, args.end()), alignment);
+}